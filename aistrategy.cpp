@@ -0,0 +1,174 @@
+/*****************************************************************************************
+ ** Program Filename: aistrategy.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the AIStrategy class.
+ ** Input: Depends on the function, but usually the maze and everybody in it.
+ ** Output: Depends on the function, but usually the move the AI wants to take.
+ ****************************************************************************************/
+#include<chrono>
+#include<cstdlib>
+#include<string>
+
+#include "consts.h"
+#include "aistrategy.h"
+#include "pathfinderai.h"
+#include "farsightai.h"
+#include "myopicai.h"
+#include "randomai.h"
+#include "suicidalai.h"
+#include "maze.h"
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "rng.h"
+
+namespace {
+	struct StrategyInfo {
+		const char* name;
+		const char* title;
+		AIStrategy* (*make)();
+	};
+
+	template<class T> AIStrategy* make() { return new T(); }
+
+	// in the same order as the AI_STRATEGY_* numbers
+	const StrategyInfo strategies[AI_NUM_STRATEGIES] = {
+		{AI_NAME_PATHFINDER, AI_TITLE_PATHFINDER, make<PathfinderAI>},
+		{AI_NAME_FARSIGHT, AI_TITLE_FARSIGHT, make<FarsightAI>},
+		{AI_NAME_MYOPIC, AI_TITLE_MYOPIC, make<MyopicAI>},
+		{AI_NAME_RANDOM, AI_TITLE_RANDOM, make<RandomAI>},
+		{AI_NAME_SUICIDAL, AI_TITLE_SUICIDAL, make<SuicidalAI>}
+	};
+}
+
+/*****************************************************************************************
+ ** Function: AIStrategy (constructor)
+ ** Description: Makes a new AIStrategy that hasn't made any moves yet.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+AIStrategy::AIStrategy() : timing(false), numDecisions(0), decisionSeconds(0) {}
+
+/*****************************************************************************************
+ ** Function: ~AIStrategy (destructor)
+ ** Description: Destroys the current AIStrategy.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+AIStrategy::~AIStrategy() {}
+
+/*****************************************************************************************
+ ** Function: decide
+ ** Description: Gets the move the AI wants to take, in the form of a normal character 
+ **				 that the user could've typed to do the same action (ex: outputs 'w' if 
+ **				 the AI wants to go up), and keeps track of how long it took to decide 
+ **				 if it's timing.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: The return value is a character that corresponds to a normal user 
+ **					 input for moving the character (WASD or space) or using a skill (P).
+ ****************************************************************************************/
+int AIStrategy::decide(const Maze& maze, Rng& rng) {
+	if (!timing) return getChar(maze, rng);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	int chr = getChar(maze, rng);
+	std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+	numDecisions++;
+	decisionSeconds += time.count();
+	return chr;
+}
+
+/*****************************************************************************************
+ ** Function: getTANear
+ ** Description: Checks if there's a TA within some number of moves of a square (going by
+ **				 rows plus columns, not around walls).
+ ** Parameters: map (const TileView&) - the map of the maze
+ **				tas (const TAGroup&) - the TAs in the maze
+ **				row (int) - the row of the square
+ **				col (int) - the column of the square
+ **				distance (int) - the most moves away a TA can be
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool AIStrategy::getTANear(const TileView& map, const TAGroup& tas, int row, int col, 
+						   int distance) {
+	for (int r = row - distance; r <= row + distance; r++) {
+		int span = distance - std::abs(r - row);
+		for (int c = col - span; c <= col + span; c++) {
+			if (map.inBounds(r, c) && tas.getCountAt(r, c) > 0) return true;
+		}
+	}
+	return false;
+}
+
+/*****************************************************************************************
+ ** Function: getMoveChar
+ ** Description: Gets the character a user would type to make a move.
+ ** Parameters: move (int) - the move (MAZE_MOVE_*)
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns WASD, or a space for MAZE_MOVE_NONE.
+ ****************************************************************************************/
+int AIStrategy::getMoveChar(int move) {
+	switch(move) {
+		case MAZE_MOVE_UP:
+			return 'w';
+		case MAZE_MOVE_LEFT:
+			return 'a';
+		case MAZE_MOVE_DOWN:
+			return 's';
+		case MAZE_MOVE_RIGHT:
+			return 'd';
+		default:
+			return ' ';
+	}
+}
+
+/*****************************************************************************************
+ ** Function: makeStrategy
+ ** Description: Makes a new AI that plays with one of the strategies.
+ ** Parameters: strategy (int) - the strategy to play with (AI_STRATEGY_*)
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns nullptr if there's no such strategy. Otherwise the caller 
+ **					 owns the new AI.
+ ****************************************************************************************/
+AIStrategy* AIStrategy::makeStrategy(int strategy) {
+	if (strategy < 0 || strategy >= AI_NUM_STRATEGIES) return nullptr;
+	return strategies[strategy].make();
+}
+
+/*****************************************************************************************
+ ** Function: getName
+ ** Description: Gets the name of a strategy, as it's typed on the command line.
+ ** Parameters: strategy (int) - the strategy (AI_STRATEGY_*)
+ ** Pre-Conditions: strategy is a valid strategy.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const char* AIStrategy::getName(int strategy) { return strategies[strategy].name; }
+
+/*****************************************************************************************
+ ** Function: getTitle
+ ** Description: Gets the name of a strategy, as it's shown in the settings.
+ ** Parameters: strategy (int) - the strategy (AI_STRATEGY_*)
+ ** Pre-Conditions: strategy is a valid strategy.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const char* AIStrategy::getTitle(int strategy) { return strategies[strategy].title; }
+
+/*****************************************************************************************
+ ** Function: findStrategy
+ ** Description: Finds a strategy by its name.
+ ** Parameters: name (const std::string&) - the name of the strategy (like from getName())
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns the strategy (AI_STRATEGY_*), or -1 if there's none by that 
+ **					 name.
+ ****************************************************************************************/
+int AIStrategy::findStrategy(const std::string& name) {
+	for (int i = 0; i < AI_NUM_STRATEGIES; i++) 
+		if (name == strategies[i].name) return i;
+	return -1;
+}
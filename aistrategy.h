@@ -0,0 +1,54 @@
+/*****************************************************************************************
+ ** Program Filename: aistrategy.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the AIStrategy class, the interface for every AI that 
+ **				 can play the game instead of the user. The maze asks its strategy for a 
+ **				 move every turn. It also keeps the list of every strategy there is, so 
+ **				 the settings and the simulator can pick one by number or name.
+ ** Input: Depends on the function, but usually the maze and everybody in it.
+ ** Output: Depends on the function, but usually the move the AI wants to take.
+ ****************************************************************************************/
+#ifndef __aistrategy_h__
+#define __aistrategy_h__
+
+#include<string>
+
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "rng.h"
+
+class Maze;
+
+class AIStrategy {
+	private:
+		// how many moves it's been asked for, and how long it took to come up with them
+		// (only kept track of when timing, since checking the clock isn't free)
+		bool timing;
+		long long numDecisions;
+		double decisionSeconds;
+	protected:
+		virtual int getChar(const Maze& maze, Rng& rng) = 0;
+
+		static bool getTANear(const TileView& map, const TAGroup& tas, int row, int col, 
+							  int distance);
+		static int getMoveChar(int move);
+	public:
+		AIStrategy();
+		virtual ~AIStrategy();
+
+		virtual AIStrategy* clone() const = 0;
+
+		int decide(const Maze& maze, Rng& rng);
+
+		void setTiming(bool time) { timing = time; }
+		long long getNumDecisions() const { return numDecisions; }
+		double getDecisionSeconds() const { return decisionSeconds; }
+
+		static AIStrategy* makeStrategy(int strategy);
+		static const char* getName(int strategy);
+		static const char* getTitle(int strategy);
+		static int findStrategy(const std::string& name);
+};
+
+#endif
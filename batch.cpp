@@ -0,0 +1,238 @@
+/*****************************************************************************************
+ ** Program Filename: batch.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for running a batch of headless games.
+ ** Input: The settings for the batch (how many games, maze size and settings, seed).
+ ** Output: The totals for the whole batch.
+ ****************************************************************************************/
+#include<cassert>
+#include<cstdint>
+#include<chrono>
+#include<atomic>
+#include<thread>
+#include<vector>
+#include<functional>
+
+#include "consts.h"
+#include "batch.h"
+#include "simulation.h"
+#include "aistrategy.h"
+#include "rng.h"
+
+namespace {
+	// each worker's games left to play, as [begin, end) packed into one word so the owner 
+	// taking from the front and thieves taking from the back can't both get a game. 
+	// padded out to a cache line so workers don't slow each other down
+	struct WorkRange {
+		std::atomic<uint64_t> range;
+		char padding[64 - sizeof(std::atomic<uint64_t>)];
+	};
+
+	uint64_t pack(uint32_t begin, uint32_t end) { return (uint64_t(begin) << 32) | end; }
+	uint32_t getBegin(uint64_t range) { return range >> 32; }
+	uint32_t getEnd(uint64_t range) { return uint32_t(range); }
+
+	/*************************************************************************************
+	 ** Function: takeOwn
+	 ** Description: Takes the next game off the front of a worker's own range.
+	 ** Parameters: work (WorkRange&) - the worker's own range
+	 **				game (uint32_t&) - output parameter for the game to play
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: Returns false if the range was empty.
+	 ************************************************************************************/
+	bool takeOwn(WorkRange& work, uint32_t& game) {
+		uint64_t range = work.range.load();
+		while (getBegin(range) < getEnd(range)) {
+			if (work.range.compare_exchange_weak(range, 
+					pack(getBegin(range) + 1, getEnd(range)))) {
+				game = getBegin(range);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/*************************************************************************************
+	 ** Function: steal
+	 ** Description: Steals the back half of some other worker's range. Games are so 
+	 **				 different in length that splitting them evenly at the start leaves 
+	 **				 threads sitting idle, so idle workers take from busy ones.
+	 ** Parameters: work (std::vector<WorkRange>&) - every worker's range
+	 **				self (int) - the worker doing the stealing
+	 ** Pre-Conditions: The worker's own range is empty.
+	 ** Post-Conditions: Returns false if there was nothing left to steal anywhere. 
+	 **					 Otherwise the stolen games are now the worker's own range.
+	 ************************************************************************************/
+	bool steal(std::vector<WorkRange>& work, int self) {
+		for (int i = 1; i < work.size(); i++) {
+			WorkRange& victim = work[(self + i) % work.size()];
+
+			uint64_t range = victim.range.load();
+			while (getBegin(range) < getEnd(range)) {
+				uint32_t mid = getBegin(range) + (getEnd(range) - getBegin(range))/2;
+				if (victim.range.compare_exchange_weak(range, pack(getBegin(range), mid))) {
+					work[self].range.store(pack(mid, getEnd(range)));
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/*************************************************************************************
+	 ** Function: runWorker
+	 ** Description: Plays games until there aren't any left for this worker to play or
+	 **				 steal. Stats are kept locally and only written out at the end.
+	 ** Parameters: config (const BatchConfig&) - the settings for the batch
+	 **				work (std::vector<WorkRange>&) - every worker's range
+	 **				self (int) - which worker this is
+	 **				stats (BatchStats&) - output parameter for this worker's totals
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: none.
+	 ************************************************************************************/
+	void runWorker(const BatchConfig& config, std::vector<WorkRange>& work, int self, 
+				   BatchStats& stats) {
+		BatchStats local;
+		uint32_t game;
+
+		while (true) {
+			// someone can steal everything back before the stolen games get played
+			if (!takeOwn(work[self], game)) {
+				if (steal(work, self)) continue;
+				break;
+			}
+
+			Simulation sim(config.width, config.height, 
+						   Batch::getGameSeed(config.baseSeed, game), config.options, 
+						   config.maxTurns);
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			sim.run();
+			std::chrono::duration<double> turnTime = std::chrono::steady_clock::now() - start;
+			local.turnSeconds += turnTime.count();
+
+			local.addGame(sim.getEnded(), sim.getWon(), sim.getTurns());
+
+			const AIStrategy* ai = sim.getMaze().getStrategy();
+			if (ai != nullptr) {
+				local.decisions += ai->getNumDecisions();
+				local.decisionSeconds += ai->getDecisionSeconds();
+			}
+		}
+		stats = local;
+	}
+}
+
+/*****************************************************************************************
+ ** Function: addGame
+ ** Description: Adds one finished game to the totals.
+ ** Parameters: ended (bool) - whether the game actually ended (false means it timed out)
+ **				won (bool) - whether the student won
+ **				turns (int) - how many turns the game took
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void BatchStats::addGame(bool ended, bool won, int turns) {
+	games++;
+	if (!ended) {
+		timeouts++;
+		return;
+	}
+
+	if (won) wins++;
+	totalTurns += turns;
+	if (minTurns < 0 || turns < minTurns) minTurns = turns;
+	if (turns > maxTurns) maxTurns = turns;
+}
+
+/*****************************************************************************************
+ ** Function: merge
+ ** Description: Adds the totals from another batch onto these ones. Wall time isn't 
+ **				 added, since batches that ran side by side took the same time.
+ ** Parameters: other (const BatchStats&) - the totals to add
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void BatchStats::merge(const BatchStats& other) {
+	games += other.games;
+	wins += other.wins;
+	timeouts += other.timeouts;
+	totalTurns += other.totalTurns;
+
+	if (other.minTurns >= 0 && (minTurns < 0 || other.minTurns < minTurns)) 
+		minTurns = other.minTurns;
+	if (other.maxTurns > maxTurns) maxTurns = other.maxTurns;
+
+	turnSeconds += other.turnSeconds;
+	decisions += other.decisions;
+	decisionSeconds += other.decisionSeconds;
+}
+
+/*****************************************************************************************
+ ** Function: getGameSeed
+ ** Description: Gets the seed for one game of a batch. Scrambled so neighboring games 
+ **				 don't get neighboring seeds, and only depends on the game number so any 
+ **				 one game can be replayed in the real game with --seed.
+ ** Parameters: baseSeed (uint64_t) - the seed of the whole batch
+ **				game (long long) - which game of the batch it is
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+uint64_t Batch::getGameSeed(uint64_t baseSeed, long long game) {
+	uint64_t x = baseSeed + uint64_t(game);
+	return Rng::splitMix(x);
+}
+
+/*****************************************************************************************
+ ** Function: getDefaultThreads
+ ** Description: Gets how many threads to run a batch on if the user doesn't say.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns one thread per core (at least 1, at most SIM_MAX_THREADS).
+ ****************************************************************************************/
+int Batch::getDefaultThreads() {
+	int cores = std::thread::hardware_concurrency();
+	if (cores > SIM_MAX_THREADS) return SIM_MAX_THREADS;
+	return cores > 0 ? cores : 1;
+}
+
+/*****************************************************************************************
+ ** Function: run
+ ** Description: Plays every game of a batch, spread over config.threads threads. Every 
+ **				 game's seed only depends on its number, so the totals are the same no 
+ **				 matter how many threads there are or who ended up playing what.
+ ** Parameters: config (const BatchConfig&) - the settings for the batch
+ ** Pre-Conditions: config.options.useAI is set (nobody is there to press keys), 
+ **					config.games is at most SIM_MAX_GAMES, and config.threads is from 1 
+ **					to SIM_MAX_THREADS.
+ ** Post-Conditions: Returns the totals for the batch, including how long it took.
+ ****************************************************************************************/
+BatchStats Batch::run(const BatchConfig& config) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	assert(config.threads >= 1 && config.threads <= SIM_MAX_THREADS);
+
+	// start everyone off with an even split, stealing fixes it up from there
+	int threads = config.threads;
+	std::vector<WorkRange> work(threads);
+	for (int i = 0; i < threads; i++) {
+		work[i].range.store(pack(config.games*i/threads, config.games*(i + 1)/threads));
+	}
+
+	// the main thread is worker 0
+	std::vector<BatchStats> results(threads);
+	std::vector<std::thread> workers;
+	for (int i = 1; i < threads; i++) {
+		workers.emplace_back(runWorker, std::cref(config), std::ref(work), i, 
+							 std::ref(results[i]));
+	}
+	runWorker(config, work, 0, results[0]);
+	for (int i = 0; i < workers.size(); i++) workers[i].join();
+
+	BatchStats stats;
+	for (int i = 0; i < threads; i++) stats.merge(results[i]);
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	stats.seconds = elapsed.count();
+	return stats;
+}
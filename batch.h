@@ -0,0 +1,57 @@
+/*****************************************************************************************
+ ** Program Filename: batch.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for running a batch of headless games and adding up how they
+ **				 went. Used by the simulator to tune the difficulty constants. Games are 
+ **				 spread over several threads that steal work from each other.
+ ** Input: The settings for the batch (how many games, maze size and settings, seed).
+ ** Output: The totals for the whole batch.
+ ****************************************************************************************/
+#ifndef __batch_h__
+#define __batch_h__
+
+#include<cstdint>
+
+#include "mazeoptions.h"
+
+struct BatchConfig {
+	long long games;
+	int width;
+	int height;
+	MazeOptions options;
+	int maxTurns;
+	uint64_t baseSeed;
+	int threads;
+};
+
+struct BatchStats {
+	long long games = 0;
+	long long wins = 0;
+	long long timeouts = 0;
+
+	// only counts games that actually ended (so not timeouts)
+	long long totalTurns = 0;
+	int minTurns = -1;
+	int maxTurns = 0;
+
+	double seconds = 0;
+
+	// time spent taking turns (not making mazes), added up over every thread
+	double turnSeconds = 0;
+
+	// moves the AI made and the time it spent deciding on them (part of turnSeconds)
+	long long decisions = 0;
+	double decisionSeconds = 0;
+
+	void addGame(bool ended, bool won, int turns);
+	void merge(const BatchStats& other);
+};
+
+namespace Batch {
+	uint64_t getGameSeed(uint64_t baseSeed, long long game);
+	int getDefaultThreads();
+	BatchStats run(const BatchConfig& config);
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*****************************************************************************************
+ ** Program Filename: cellpool.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the CellPool class.
+ ** Input: Depends on the function, but usually the tile index of a square.
+ ** Output: Depends on the function, but it generally gives out squares in the pool.
+ ****************************************************************************************/
+#include<vector>
+
+#include "cellpool.h"
+
+/*****************************************************************************************
+ ** Function: CellPool (constructor)
+ ** Description: Makes a new empty pool for a maze with the given number of squares.
+ ** Parameters: numTiles (int) - the number of squares in the maze
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+CellPool::CellPool(int numTiles) : slots(numTiles, -1) { cells.reserve(numTiles); }
+
+/*****************************************************************************************
+ ** Function: add
+ ** Description: Adds a square to the pool. Does nothing if it's already in it.
+ ** Parameters: index (int) - the tile index of the square
+ ** Pre-Conditions: The index is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void CellPool::add(int index) {
+	if (slots[index] != -1) return;
+
+	slots[index] = cells.size();
+	cells.push_back(index);
+}
+
+/*****************************************************************************************
+ ** Function: remove
+ ** Description: Removes a square from the pool by moving the last square into its slot.
+ **				 Does nothing if it isn't in the pool.
+ ** Parameters: index (int) - the tile index of the square
+ ** Pre-Conditions: The index is in bounds.
+ ** Post-Conditions: The order of the rest of the pool may have changed.
+ ****************************************************************************************/
+void CellPool::remove(int index) {
+	int slot = slots[index];
+	if (slot == -1) return;
+
+	int last = cells.back();
+	cells[slot] = last;
+	slots[last] = slot;
+	cells.pop_back();
+	slots[index] = -1;
+}
+
+/*****************************************************************************************
+ ** Function: contains
+ ** Description: Checks whether a square is in the pool.
+ ** Parameters: index (int) - the tile index of the square
+ ** Pre-Conditions: The index is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool CellPool::contains(int index) const { return slots[index] != -1; }
+
+/*****************************************************************************************
+ ** Function: size
+ ** Description: Gets the number of squares in the pool.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int CellPool::size() const { return cells.size(); }
+
+/*****************************************************************************************
+ ** Function: get
+ ** Description: Gets the square in the given slot of the pool. Picking a random slot
+ **				 gives a random square in the pool.
+ ** Parameters: slot (int) - the slot to get, from 0 to size() - 1
+ ** Pre-Conditions: The slot is in bounds.
+ ** Post-Conditions: Returns the tile index of the square.
+ ****************************************************************************************/
+int CellPool::get(int slot) const { return cells[slot]; }
@@ -0,0 +1,33 @@
+/*****************************************************************************************
+ ** Program Filename: cellpool.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the CellPool class, which is a set of squares in the maze
+ **				 (by tile index) that can be added to, removed from, and indexed into all in
+ **				 constant time. It's used to pick random squares without retrying.
+ ** Input: Depends on the function, but usually the tile index of a square.
+ ** Output: Depends on the function, but it generally gives out squares in the pool.
+ ****************************************************************************************/
+#ifndef __cellpool_h__
+#define __cellpool_h__
+
+#include<vector>
+
+class CellPool {
+	private:
+		// the squares in the pool, in no particular order
+		std::vector<int> cells;
+		// where each square is in cells (or -1 if it isn't in the pool), by tile index
+		std::vector<int> slots;
+	public:
+		CellPool(int numTiles);
+
+		void add(int index);
+		void remove(int index);
+		bool contains(int index) const;
+
+		int size() const;
+		int get(int slot) const;
+};
+
+#endif
@@ -0,0 +1,185 @@
+/*****************************************************************************************
+ ** Program Filename: cmdargs.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the command line arguments of the game.
+ ** Input: Depends on the function, but usually the arguments from main.
+ ** Output: Depends on the function, but it generally gives out the parsed settings.
+ ****************************************************************************************/
+#include<iostream>
+#include<fstream>
+#include<string>
+#include<cstdint>
+#include<cstdlib>
+
+#include "consts.h"
+#include "cmdargs.h"
+#include "rng.h"
+
+namespace {
+	bool hasSeed = false;
+	uint64_t seed = 0;
+	bool usePad = false;
+	bool showStats = false;
+	int tickMs = 0;
+	std::string recordFile;
+	std::string replayFile;
+}
+
+/*****************************************************************************************
+ ** Function: parseNumber
+ ** Description: Parses a whole number out of a string.
+ ** Parameters: str (const char*) - the string to parse
+ **				out (uint64_t&) - output parameter for the number
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns false if the string wasn't entirely a number.
+ ****************************************************************************************/
+bool CmdArgs::parseNumber(const char* str, uint64_t& out) {
+	if (str == nullptr || *str < '0' || *str > '9') return false;
+
+	char* end;
+	out = std::strtoull(str, &end, 10);
+	return *end == '\0';
+}
+
+/*****************************************************************************************
+ ** Function: parse
+ ** Description: Parses the command line arguments given to the program.
+ ** Parameters: argc (int) - the number of arguments (including the program name)
+ **				argv (char**) - the arguments themselves
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns false if something was wrong with the arguments, after
+ **					 printing what to stderr.
+ ****************************************************************************************/
+bool CmdArgs::parse(int argc, char** argv) {
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+
+		if (arg == "-s" || arg == "--seed") {
+			if (i + 1 >= argc || !parseNumber(argv[i + 1], seed)) {
+				std::cerr << arg << " needs a whole number after it" << std::endl;
+				return false;
+			}
+			hasSeed = true;
+			i++;
+		}
+		else if (arg == "--tick") {
+			uint64_t ms;
+			if (i + 1 >= argc || !parseNumber(argv[i + 1], ms) || ms == 0 || 
+				ms > GAME_MAX_TICK_MS) {
+				std::cerr << arg << " needs a number of milliseconds from 1 to " 
+						  << GAME_MAX_TICK_MS << " after it" << std::endl;
+				return false;
+			}
+			tickMs = (int) ms;
+			i++;
+		}
+		else if (arg == "--record" || arg == "--replay") {
+			if (i + 1 >= argc) {
+				std::cerr << arg << " needs a file name after it" << std::endl;
+				return false;
+			}
+			if (arg == "--record") recordFile = argv[i + 1];
+			else replayFile = argv[i + 1];
+			i++;
+		}
+		else if (arg == "--pad") usePad = true;
+		else if (arg == "--stats") showStats = true;
+		else {
+			std::cerr << "unknown argument: " << arg << std::endl;
+			printUsage(argv[0]);
+			return false;
+		}
+	}
+
+	// better to find out now than after the game is over
+	if (recordFile != "" && !std::ofstream(recordFile, std::ios::app).good()) {
+		std::cerr << "can't write to " << recordFile << std::endl;
+		return false;
+	}
+	return true;
+}
+
+/*****************************************************************************************
+ ** Function: printUsage
+ ** Description: Prints out how to use the program to stderr.
+ ** Parameters: exeName (const char*) - the name the program was run with
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void CmdArgs::printUsage(const char* exeName) {
+	std::cerr << "usage: " << exeName << " [--seed N] [--tick MS] " 
+			  << "[--record FILE | --replay FILE] [--pad] [--stats]" << std::endl;
+	std::cerr << "  -s, --seed N    use the same seed N for every maze (to replay a game)"
+			  << std::endl;
+	std::cerr << "  --tick MS       real-time mode, everybody moves every MS milliseconds "
+			  << "whether a key was pressed or not" << std::endl;
+	std::cerr << "  --record FILE   save a replay of the last game played to FILE" 
+			  << std::endl;
+	std::cerr << "  --replay FILE   watch the replay in FILE instead of playing" 
+			  << std::endl;
+	std::cerr << "  --pad           draw the whole maze once and scroll over it (faster "
+			  << "camera on big mazes)" << std::endl;
+	std::cerr << "  --stats         print how much was written to the terminal when done" 
+			  << std::endl;
+}
+
+/*****************************************************************************************
+ ** Function: getSeed
+ ** Description: Gets the seed to make the next maze with.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns the seed from the command line if there was one, or a new
+ **					 random seed otherwise.
+ ****************************************************************************************/
+uint64_t CmdArgs::getSeed() {
+	if (hasSeed) return seed;
+	return Rng::makeSeed();
+}
+
+/*****************************************************************************************
+ ** Function: getUsePad
+ ** Description: Gets whether the maze should be drawn to a pad instead of straight to
+ **				 its window.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool CmdArgs::getUsePad() { return usePad; }
+
+/*****************************************************************************************
+ ** Function: getShowStats
+ ** Description: Gets whether the terminal output should be counted and printed at the 
+ **				 end.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool CmdArgs::getShowStats() { return showStats; }
+
+/*****************************************************************************************
+ ** Function: getTickMs
+ ** Description: Gets how long a tick is in real-time mode.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns 0 if the game should wait for the user every turn instead.
+ ****************************************************************************************/
+int CmdArgs::getTickMs() { return tickMs; }
+
+/*****************************************************************************************
+ ** Function: getRecordFile
+ ** Description: Gets the file to save replays to.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns "" if games shouldn't be recorded.
+ ****************************************************************************************/
+const std::string& CmdArgs::getRecordFile() { return recordFile; }
+
+/*****************************************************************************************
+ ** Function: getReplayFile
+ ** Description: Gets the replay file to watch.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns "" if the game should be played normally.
+ ****************************************************************************************/
+const std::string& CmdArgs::getReplayFile() { return replayFile; }
@@ -0,0 +1,42 @@
+/*****************************************************************************************
+ ** Program Filename: cmdargs.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the command line arguments of the game. They're parsed
+ **				 once in main and then read by whatever panel needs them.
+ ** Input: Depends on the function, but usually the arguments from main.
+ ** Output: Depends on the function, but it generally gives out the parsed settings.
+ ****************************************************************************************/
+#ifndef __cmdargs_h__
+#define __cmdargs_h__
+
+#include<cstdint>
+#include<string>
+
+namespace CmdArgs {
+	// returns false (after printing why) if the arguments don't make sense
+	bool parse(int argc, char** argv);
+	void printUsage(const char* exeName);
+
+	// parses a whole number (no sign) out of a string, shared with the simulator
+	bool parseNumber(const char* str, uint64_t& out);
+
+	// the seed from --seed if there was one, otherwise a new random seed every call
+	uint64_t getSeed();
+
+	// whether --pad was given (draw the whole maze to a pad once instead of every frame)
+	bool getUsePad();
+
+	// whether --stats was given (print how much was written to the terminal at the end)
+	bool getShowStats();
+
+	// milliseconds per tick from --tick (real-time mode), or 0 to wait for every turn
+	int getTickMs();
+
+	// the file from --record to save each game's replay to, or "" to not record
+	const std::string& getRecordFile();
+	// the file from --replay to watch instead of playing, or "" to play normally
+	const std::string& getReplayFile();
+}
+
+#endif
@@ -69,12 +69,22 @@
 #define GAME_HUD_WIDTH_2 30
 
 #define GAME_HUD_TEXT_QUIT "Q to quit"
+#define GAME_HUD_TEXT_SEED "Seed: "
 #define GAME_HUD_TEXT_SKILLS "Num skills: "
 #define GAME_HUD_TEXT_TA "TAs: "
 #define GAME_HUD_TEXT_MOVE "WASD or arrows to move"
-#define GAME_HUD_TEXT_CAMERA "IJKL to move camera"
+#define GAME_HUD_TEXT_CAMERA "IJKL camera, M map, Z zoom"
 #define GAME_HUD_TEXT_DEMO "P to demo a skill"
 #define GAME_HUD_TEXT_AI "SPACE or ENTER to advance"
+#define GAME_HUD_TEXT_AUTO "R play, F faster, E finish"
+#define GAME_HUD_TEXT_REPLAY ", . step, [ ] skip"
+#define GAME_HUD_TEXT_TURN "Turn: "
+// whose autoplay it is, then how it's going
+#define GAME_HUD_TEXT_AI_NAME "AI "
+#define GAME_HUD_TEXT_REPLAY_NAME "Replay "
+#define GAME_HUD_TEXT_PAUSED "paused"
+#define GAME_HUD_TEXT_PLAYING "playing x"
+#define GAME_HUD_TEXT_FINISHING "finishing the game"
 
 #define GAME_CPAIR_PLAYER 1
 #define GAME_CPAIR_TA_INSTRUCTOR 2
@@ -82,7 +92,23 @@
 #define GAME_CPAIR_SKILL 4
 #define GAME_CPAIR_WALL_FOG 5
 
-#define GAME_SQUARE_SIZE 3		// multiple of 3 for best results
+#define GAME_SQUARE_SIZE 3		// starting zoom (chars per side of a square), 1, 3, or 5
+#define GAME_MAX_SQUARE_SIZE 5
+
+// biggest pad (in chars) the maze is drawn to with --pad, fits a 999x999 maze (~36MB)
+#define GAME_PAD_MAX_CELLS 9000000LL
+// longest tick allowed for --tick (milliseconds)
+#define GAME_MAX_TICK_MS 60000
+// milliseconds between AI turns when it plays by itself (unless --tick is given)
+#define GAME_AUTOPLAY_MS 100
+// most turns the AI can take between frames when fast forwarding (a power of 10)
+#define GAME_MAX_FAST_FORWARD 1000
+// milliseconds of turns between frames when the AI is finishing the game
+#define GAME_FINISH_FRAME_MS 100
+
+// minimap blocks with some walls in them (up to a third, then up to two thirds)
+#define MINIMAP_CHAR_SPARSE '.'
+#define MINIMAP_CHAR_MEDIUM ':'
 
 /**********************************  GAME ALERT CONSTS  *********************************/
 
@@ -203,6 +229,30 @@
 #define MAZE_DIFF_MULT_SKILLS -0.5
 
 #define MAZE_FOG_SIZE 3
+// how far the student can see with line of sight fog (walls block it though)
+#define MAZE_SIGHT_SIZE 8
+
+// number of skills the student needs to pass when they reach the instructor
+#define MAZE_SKILLS_TO_PASS 3
+
+// how the map gets generated: retry throws whole maps away until one happens to be valid,
+// construct reserves the paths that make it valid first so it only ever takes one try
+#define MAZE_GEN_RETRY 0
+#define MAZE_GEN_CONSTRUCT 1
+#define MAZE_GEN_DEFAULT MAZE_GEN_CONSTRUCT
+
+// each maze splits its seed into separate random streams
+#define MAZE_RNG_STREAM_GEN 0
+#define MAZE_RNG_STREAM_TA 1
+#define MAZE_RNG_STREAM_AI 2
+
+// tile grid bytes (low bit is the kind of square, the rest are flags on top of it)
+#define TILE_OPEN 0x00
+#define TILE_WALL 0x01
+#define TILE_KIND_MASK 0x01
+#define TILE_SKILL 0x02
+// the instructor's square (the instructor never moves, so it's kept right in the grid)
+#define TILE_INSTRUCTOR 0x04
 
 // moves
 #define MAZE_MOVE_NONE 0
@@ -211,6 +261,40 @@
 #define MAZE_MOVE_LEFT 3
 #define MAZE_MOVE_RIGHT 4
 
+#define TA_APPEASED_TURNS 10
+
+// moves away a TA can be from a square and still get next to it in one turn (so the AI 
+// won't step there), and how close one has to get before the AI uses a skill on it
+#define AI_TA_REACH 2
+#define AI_STRIKE_DISTANCE 2
+
+// every AI strategy, in the order the settings go through them
+#define AI_STRATEGY_PATHFINDER 0
+#define AI_STRATEGY_FARSIGHT 1
+#define AI_STRATEGY_MYOPIC 2
+#define AI_STRATEGY_RANDOM 3
+#define AI_STRATEGY_SUICIDAL 4
+#define AI_NUM_STRATEGIES 5
+
+// names for the command line and replay files (no spaces), then for the settings
+#define AI_NAME_PATHFINDER "pathfinder"
+#define AI_NAME_FARSIGHT "farsight"
+#define AI_NAME_MYOPIC "myopic"
+#define AI_NAME_RANDOM "random"
+#define AI_NAME_SUICIDAL "suicidal"
+
+#define AI_TITLE_PATHFINDER " Pathfinder "
+#define AI_TITLE_FARSIGHT " Farsight "
+#define AI_TITLE_MYOPIC " Myopic "
+#define AI_TITLE_RANDOM " Random "
+#define AI_TITLE_SUICIDAL " Suicidal "
+
+// what the myopic AI thinks of a move (lower is better), it only looks one square away
+#define AI_COST_TA_NEAR 10
+#define AI_COST_WAIT 1
+#define AI_COST_SKILL -5
+#define AI_COST_PASS -100
+
 #define TA_TEXT_APPEASED_1 "Appeased ("
 #define TA_TEXT_APPEASED_2 " turns)"
 #define TA_TEXT_NOT_APPEASED "On the hunt"
@@ -234,12 +318,15 @@
 #define OPTION_DIFF_DESC "Difficulty: "
 #define OPTION_FOG_DESC "Fog of war: "
 #define OPTION_AI_DESC "Let the AI out to play: "		// 24 chars
+#define OPTION_STRATEGY_DESC "AI strategy: "
 #define OPTION_BACK_DESC "Back"
 
 #define OPTION_BUTTON_BACK 0
 #define OPTION_BUTTON_DIFF 1
 #define OPTION_BUTTON_FOG 2
 #define OPTION_BUTTON_AI 3
+#define OPTION_BUTTON_STRATEGY 4
+#define OPTION_NUM_BUTTONS 5
 
 #define OPTION_DIFF_EASY -1
 #define OPTION_DIFF_MED 0
@@ -249,8 +336,52 @@
 #define OPTION_DIFF_MED_DESC " Medium "
 #define OPTION_DIFF_HARD_DESC " Hard "
 
+// fog of war: none, a square around the student, or what the student can see past walls
+#define OPTION_FOG_OFF 0
+#define OPTION_FOG_SQUARE 1
+#define OPTION_FOG_SIGHT 2
+
+#define OPTION_FOG_OFF_DESC " Off "
+#define OPTION_FOG_SQUARE_DESC " Nearby "
+#define OPTION_FOG_SIGHT_DESC " Line of sight "
+
 #define OPTION_DIFF_DEFAULT OPTION_DIFF_MED
-#define OPTION_FOG_DEFAULT false
+#define OPTION_FOG_DEFAULT OPTION_FOG_OFF
 #define OPTION_AI_DEFAULT false
+#define OPTION_STRATEGY_DEFAULT AI_STRATEGY_PATHFINDER
+
+/************************************  REPLAY CONSTS  ***********************************/
+
+// first line of a replay file, and the version of the format after it
+#define REPLAY_FILE_HEADER "ass4-replay"
+#define REPLAY_FILE_VERSION 1
+// how a turn spent waiting (space or enter) is written, and how long lines of turns get
+#define REPLAY_CHAR_WAIT '.'
+#define REPLAY_LINE_LENGTH 80
+
+// turns between snapshots of the maze, so seeking never replays more than this many turns
+#define REPLAY_SNAPSHOT_TURNS 256
+// ...unless that would take more memory than this for all of them (then they're spread 
+// out more), going by about a byte for the tile and 4 for the TA count of every square
+#define REPLAY_SNAPSHOT_MEMORY 268435456LL
+#define REPLAY_SNAPSHOT_CELL_BYTES 5
+// turns skipped by [ and ] when watching a replay
+#define REPLAY_SEEK_TURNS 100
+
+/************************************  SIM CONSTS  **************************************/
+
+// defaults for the headless batch runner (ass4-sim)
+#define SIM_DEFAULT_GAMES 1000
+#define SIM_DEFAULT_SIZE 20
+
+// the most games in one batch (game numbers get packed into 32 bits for work stealing)
+#define SIM_MAX_GAMES 4294967295LL
+// the most threads a batch can be played on (way more than any machine this runs on)
+#define SIM_MAX_THREADS 1024
+
+// a random AI can wander forever, so games are cut off (and counted as timeouts) here
+#define SIM_DEFAULT_MAX_TURNS 100000
+// turn counts are ints, so --max-turns can't go past the biggest one
+#define SIM_MAX_TURNS 2147483647
 
 #endif
\ No newline at end of file
@@ -0,0 +1,146 @@
+/*****************************************************************************************
+ ** Program Filename: distancefield.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the DistanceField class, a breadth first search out from
+ **				 one square of the maze that keeps how many moves away every square it 
+ **				 reached is, and which way to go first to get there. The AI builds one 
+ **				 from the student every turn.
+ ** Input: Depends on the function, but usually the maze, where to start, and what can't 
+ **		   be walked through.
+ ** Output: Depends on the function, but it generally gives out distances and moves.
+ ****************************************************************************************/
+#ifndef __distancefield_h__
+#define __distancefield_h__
+
+#include<vector>
+
+#include "consts.h"
+#include "tilegrid.h"
+
+class DistanceField {
+	private:
+		// squares waiting to be expanded (as tile indices), used as a plain FIFO
+		std::vector<int> frontier;
+		// moves from the start to each square, only good where it was reached
+		std::vector<int> dist;
+		// the first move (MAZE_MOVE_*) on a shortest path to each square reached
+		std::vector<unsigned char> firstMoves;
+		// which search last reached each square, so nothing's cleared between searches
+		std::vector<unsigned> reached;
+		unsigned searchId;
+		// where the last search started, or -1 if there hasn't been one
+		int start;
+
+		template<class Blocked> 
+		void visit(const unsigned char* tiles, int from, int to, int row, int col, 
+				   int move, Blocked& blocked);
+	public:
+		DistanceField() : searchId(0), start(-1) {}
+		// it's all scratch space from the last search, so copies don't need any of it
+		DistanceField(const DistanceField&) : searchId(0), start(-1) {}
+		DistanceField& operator=(const DistanceField&) { 
+			start = -1;
+			return *this; 
+		}
+
+		template<class Blocked, class IsTarget> 
+		int search(const TileView& map, int startRow, int startCol, Blocked blocked, 
+				   IsTarget isTarget);
+
+		int getDistance(int index) const { 
+			return reached[index] == searchId ? dist[index] : -1; 
+		}
+		int getFirstMove(int index) const { return firstMoves[index]; }
+		int getStart() const { return start; }
+};
+
+/*****************************************************************************************
+ ** Function: search
+ ** Description: Searches out from the start square through open squares (never the 
+ **				 instructor's), nearest first, until it finds a target. Every square is 
+ **				 looked at once at most, so it's linear in the size of the maze.
+ ** Parameters: map (const TileView&) - the maze to search
+ **				startRow (int) - the row to start from
+ **				startCol (int) - the column to start from
+ **				blocked (Blocked) - called with (row, column, distance) for each open 
+ **					square found, returns true if it can't be walked through
+ **				isTarget (IsTarget) - called with (row, column) for each square reached
+ **					(besides the start), returns true if it's what's being looked for
+ ** Pre-Conditions: The start square is in bounds.
+ ** Post-Conditions: Returns the tile index of the nearest target, or -1 if none could be
+ **					 reached. getDistance() and getFirstMove() work for every square 
+ **					 reached before it stopped.
+ ****************************************************************************************/
+template<class Blocked, class IsTarget> 
+int DistanceField::search(const TileView& map, int startRow, int startCol, 
+						  Blocked blocked, IsTarget isTarget) {
+	int rows = map.getRows(), cols = map.getCols();
+	const unsigned char* tiles = map.getRow(0);
+	if (dist.size() != rows*cols) {
+		dist.assign(rows*cols, 0);
+		firstMoves.assign(rows*cols, MAZE_MOVE_NONE);
+		reached.assign(rows*cols, 0);
+		searchId = 0;
+	}
+	// wrapping back around to 0 would make every square look reached
+	if (++searchId == 0) {
+		reached.assign(rows*cols, 0);
+		searchId = 1;
+	}
+	frontier.clear();
+	frontier.reserve(rows*cols);
+
+	start = map.index(startRow, startCol);
+	dist[start] = 0;
+	firstMoves[start] = MAZE_MOVE_NONE;
+	reached[start] = searchId;
+	frontier.push_back(start);
+
+	for (int head = 0; head < frontier.size(); head++) {
+		int curr = frontier[head];
+		int row = curr / cols, col = curr % cols;
+		if (head > 0 && isTarget(row, col)) return curr;
+
+		// bounds checked by row/col so indices don't wrap
+		if (row > 0) 
+			visit(tiles, curr, curr - cols, row - 1, col, MAZE_MOVE_UP, blocked);
+		if (row < rows - 1) 
+			visit(tiles, curr, curr + cols, row + 1, col, MAZE_MOVE_DOWN, blocked);
+		if (col > 0) 
+			visit(tiles, curr, curr - 1, row, col - 1, MAZE_MOVE_LEFT, blocked);
+		if (col < cols - 1) 
+			visit(tiles, curr, curr + 1, row, col + 1, MAZE_MOVE_RIGHT, blocked);
+	}
+	return -1;
+}
+
+/*****************************************************************************************
+ ** Function: visit
+ ** Description: Queues up a square next to one being expanded, if it hasn't been reached
+ **				 yet and can be walked through.
+ ** Parameters: tiles (const unsigned char*) - the maze's tiles, row-major
+ **				from (int) - the tile index of the square being expanded
+ **				to (int) - the tile index of the square next to it
+ **				row (int) - the row of the square next to it
+ **				col (int) - the column of the square next to it
+ **				move (int) - the move (MAZE_MOVE_*) that goes from from to to
+ **				blocked (Blocked&) - same as in search()
+ ** Pre-Conditions: to is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+template<class Blocked> 
+void DistanceField::visit(const unsigned char* tiles, int from, int to, int row, 
+						  int col, int move, Blocked& blocked) {
+	if (reached[to] == searchId) return;
+	if ((tiles[to] & TILE_KIND_MASK) != TILE_OPEN || (tiles[to] & TILE_INSTRUCTOR)) 
+		return;
+	if (blocked(row, col, dist[from] + 1)) return;
+
+	reached[to] = searchId;
+	dist[to] = dist[from] + 1;
+	firstMoves[to] = dist[from] == 0 ? move : firstMoves[from];
+	frontier.push_back(to);
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*****************************************************************************************
+ ** Program Filename: farsightai.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the FarsightAI class. 
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#include "consts.h"
+#include "farsightai.h"
+#include "maze.h"
+#include "tilegrid.h"
+
+/*****************************************************************************************
+ ** Function: findSkill
+ ** Description: Finds the skill the AI should go for next, which is the one with the 
+ **				 fewest moves to get to it and then from it to the instructor. It has to 
+ **				 search past the nearest skill, but only until nothing further out 
+ **				 could beat the best one so far.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				hunted (bool) - whether the TAs are after the AI (not appeased)
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: Returns the skill's tile index, or -1 if it can't get to any. The 
+ **					 distance field is from the AI either way.
+ ****************************************************************************************/
+int FarsightAI::findSkill(const Maze& maze, bool hunted) {
+	buildHomeField(maze);
+	TileView map = maze.getTiles();
+	const IntrepidStudent* student = maze.getStudent();
+	bestSkill = -1;
+	bestMoves = 0;
+	leastMoves = homeField.getDistance(map.index(student->getRow(), student->getCol()));
+
+	search(maze, hunted, false);
+	return bestSkill;
+}
+
+/*****************************************************************************************
+ ** Function: checkSkill
+ ** Description: Checks a square the search for a skill got to, keeping it if it's a 
+ **				 better skill than the best so far. Every square after it is at least 
+ **				 as far from the AI and at least 1 move from the instructor, and no skill 
+ **				 takes fewer moves than just going home, so it can stop once the best 
+ **				 one can't be beaten.
+ ** Parameters: map (const TileView&) - the map of the maze
+ **				row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: field has this square's distance from the AI, and findSkill() has 
+ **					set up the search.
+ ** Post-Conditions: Returns true if the search should stop at this square.
+ ****************************************************************************************/
+bool FarsightAI::checkSkill(const TileView& map, int row, int col) {
+	int index = map.index(row, col);
+	int distance = field.getDistance(index);
+	if (map.hasSkill(row, col)) {
+		// anywhere the AI can get to is connected to the instructor, so this is set
+		int moves = distance + homeField.getDistance(index);
+		if (bestSkill == -1 || moves < bestMoves) {
+			bestSkill = index;
+			bestMoves = moves;
+		}
+	}
+	return bestSkill != -1 && (bestMoves <= leastMoves || bestMoves <= distance + 1);
+}
+
+/*****************************************************************************************
+ ** Function: clone
+ ** Description: Makes a copy of this AI, for copies of the maze it's playing in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The caller owns the copy.
+ ****************************************************************************************/
+AIStrategy* FarsightAI::clone() const { return new FarsightAI(*this); }
@@ -0,0 +1,32 @@
+/*****************************************************************************************
+ ** Program Filename: farsightai.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the FarsightAI class, the AI strategy that plans ahead a
+ **				 bit. It goes for the skill that's on the way to the instructor (the 
+ **				 fewest moves to get there and then to the instructor) instead of just 
+ **				 the nearest one. Otherwise it plays like PathfinderAI, skills and all.
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#ifndef __farsightai_h__
+#define __farsightai_h__
+
+#include "pathfinderai.h"
+
+class FarsightAI : public PathfinderAI {
+	private:
+		// the best skill the search has got to so far, and how many moves it takes to
+		// get there and then to the instructor
+		int bestSkill, bestMoves;
+		// the fewest moves any skill could take, which is just the way home
+		int leastMoves;
+	protected:
+		virtual int findSkill(const Maze& maze, bool hunted) override;
+		virtual bool checkSkill(const TileView& map, int row, int col) override;
+	public:
+		FarsightAI() : bestSkill(-1), bestMoves(0), leastMoves(0) {}
+		virtual AIStrategy* clone() const override;
+};
+
+#endif
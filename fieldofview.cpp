@@ -0,0 +1,104 @@
+/*****************************************************************************************
+ ** Program Filename: fieldofview.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the FieldOfView class.
+ ** Input: Depends on the function, but usually the tiles and where to look from.
+ ** Output: Depends on the function, but it generally gives out whether a square can be 
+ **			seen.
+ ****************************************************************************************/
+#include<vector>
+#include<algorithm>
+
+#include "fieldofview.h"
+#include "tilegrid.h"
+
+namespace {
+	// turns the first octant into each of the 8 octants around the origin
+	const int OCTANT_XX[] = {1, 0, 0, -1, -1, 0, 0, 1};
+	const int OCTANT_XY[] = {0, 1, -1, 0, 0, -1, 1, 0};
+	const int OCTANT_YX[] = {0, 1, 1, 0, 0, -1, -1, 0};
+	const int OCTANT_YY[] = {1, 0, 0, 1, -1, 0, 0, -1};
+}
+
+/*****************************************************************************************
+ ** Function: FieldOfView (constructor)
+ ** Description: Makes a new FieldOfView where nothing can be seen yet.
+ ** Parameters: radius (int) - how far can be seen (in both directions, so it's a square)
+ ** Pre-Conditions: radius isn't negative.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+FieldOfView::FieldOfView(int radius) : radius(radius), size(2*radius + 1), originRow(-1), 
+	originCol(-1), visible(size*size, 0) {}
+
+/*****************************************************************************************
+ ** Function: update
+ ** Description: Works out what can be seen from the given square, unless that was 
+ **				 already the origin (the walls never change once the maze is made, so the 
+ **				 origin is all that matters).
+ ** Parameters: tiles (const TileView&) - the maze's tiles
+ **				row (int) - the row to look from
+ **				col (int) - the column to look from
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: Returns true if anything was worked out again.
+ ****************************************************************************************/
+bool FieldOfView::update(const TileView& tiles, int row, int col) {
+	if (row == originRow && col == originCol) return false;
+
+	originRow = row;
+	originCol = col;
+	std::fill(visible.begin(), visible.end(), 0);
+	visible[radius*size + radius] = 1;
+
+	for (int i = 0; i < 8; i++) 
+		castLight(tiles, 1, 1.0, 0.0, OCTANT_XX[i], OCTANT_XY[i], OCTANT_YX[i], OCTANT_YY[i]);
+	return true;
+}
+
+/*****************************************************************************************
+ ** Function: castLight
+ ** Description: Marks what can be seen in one octant, going out a row at a time. When a 
+ **				 wall starts, the part of the view before it gets followed on its own 
+ **				 (recursively) and the rest carries on after the wall.
+ ** Parameters: tiles (const TileView&) - the maze's tiles
+ **				depth (int) - how many rows out from the origin to start at
+ **				start (double) - the slope the view starts at
+ **				end (double) - the slope the view ends at
+ **				xx, xy, yx, yy (int) - turn the octant's coords into maze coords
+ ** Pre-Conditions: originRow and originCol are set.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void FieldOfView::castLight(const TileView& tiles, int depth, double start, double end, 
+							int xx, int xy, int yx, int yy) {
+	if (start < end) return;
+
+	double newStart = 0;
+	for (int i = depth; i <= radius; i++) {
+		bool blocked = false;
+		for (int dx = -i, dy = -i; dx <= 0; dx++) {
+			double leftSlope = (dx - 0.5)/(dy + 0.5), rightSlope = (dx + 0.5)/(dy - 0.5);
+			if (start < rightSlope) continue;
+			if (end > leftSlope) break;
+
+			int row = originRow + dx*yx + dy*yy, col = originCol + dx*xx + dy*xy;
+			// the edge of the maze blocks the view like a wall
+			bool wall = !tiles.inBounds(row, col) || !tiles.isOccupiable(row, col);
+			if (tiles.inBounds(row, col)) 
+				visible[(row - originRow + radius)*size + col - originCol + radius] = 1;
+
+			if (blocked) {
+				if (wall) newStart = rightSlope;
+				else {
+					blocked = false;
+					start = newStart;
+				}
+			}
+			else if (wall && i < radius) {
+				blocked = true;
+				castLight(tiles, i + 1, start, leftSlope, xx, xy, yx, yy);
+				newStart = rightSlope;
+			}
+		}
+		if (blocked) break;
+	}
+}
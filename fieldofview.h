@@ -0,0 +1,42 @@
+/*****************************************************************************************
+ ** Program Filename: fieldofview.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the FieldOfView class, which works out which squares can
+ **				 be seen from a single square (walls block the view) with recursive 
+ **				 shadowcasting. Only a square of radius squares around the origin is kept,
+ **				 and it's only worked out again when the origin moves.
+ ** Input: Depends on the function, but usually the tiles and where to look from.
+ ** Output: Depends on the function, but it generally gives out whether a square can be 
+ **			seen.
+ ****************************************************************************************/
+#ifndef __fieldofview_h__
+#define __fieldofview_h__
+
+#include<vector>
+
+#include "tilegrid.h"
+
+class FieldOfView {
+	private:
+		int radius, size;
+		int originRow, originCol;
+		// size by size, centered on the origin
+		std::vector<unsigned char> visible;
+
+		void castLight(const TileView& tiles, int depth, double start, double end, 
+					   int xx, int xy, int yx, int yy);
+	public:
+		FieldOfView(int radius);
+
+		bool update(const TileView& tiles, int row, int col);
+
+		// called for every square on screen, so it stays inline
+		bool isVisible(int row, int col) const {
+			int r = row - originRow + radius, c = col - originCol + radius;
+			if (r < 0 || r >= size || c < 0 || c >= size) return false;
+			return visible[r*size + c] != 0;
+		}
+};
+
+#endif
@@ -10,15 +10,60 @@
 #include<ncurses.h>
 #include<string>
 #include<math.h>
+#include<vector>
+#include<algorithm>
 
 #include "consts.h"
 #include "ncursesutils.h"
+#include "cmdargs.h"
+#include "termstats.h"
 
 #include "game.h"
 #include "mazeperson.h"
-#include "ta.h"
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "replay.h"
 
 #include "startpanel.h"
+#include "optionspanel.h"
+
+namespace {
+	// people are drawn as a plus a third of the square wide (at least 1), centered on it
+	constexpr int plusWidth(int size) { return size/3 > 1 ? size/3 : 1; }
+	constexpr int plusStart(int size) { return (size - plusWidth(size))/2; }
+	constexpr bool inPlusBand(int size, int x) {
+		return x >= plusStart(size) && x < plusStart(size) + plusWidth(size);
+	}
+	constexpr bool inPlus(int size, int i) {
+		return inPlusBand(size, i / size) || inPlusBand(size, i % size);
+	}
+
+	// 0, 1, ..., N-1 as a template parameter pack
+	template<int... I> struct IndexList {};
+	template<int N, int... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+	template<int... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+	// which chars of a SIZE by SIZE square are part of the plus, made at compile time
+	template<int SIZE, class List = typename MakeIndexList<SIZE*SIZE>::type> struct PlusMask;
+	template<int SIZE, int... I> struct PlusMask<SIZE, IndexList<I...>> {
+		static constexpr bool cells[SIZE*SIZE] = {inPlus(SIZE, I)...};
+	};
+	template<int SIZE, int... I> constexpr bool PlusMask<SIZE, IndexList<I...>>::cells[];
+
+	/*************************************************************************************
+	 ** Function: stampPerson
+	 ** Description: Draws a single person on top of a square.
+	 ** Parameters: stamp (chtype*) - the square to draw on, row by row
+	 **				ch (chtype) - the character to draw the person with
+	 ** Pre-Conditions: stamp has room for SIZE*SIZE chars.
+	 ** Post-Conditions: none.
+	 ************************************************************************************/
+	template<int SIZE> void stampPerson(chtype* stamp, chtype ch) {
+		for (int i = 0; i < SIZE*SIZE; i++) {
+			if (PlusMask<SIZE>::cells[i]) stamp[i] = ch;
+		}
+	}
+}
 
 /*****************************************************************************************
  ** Function: Game (constructor)
@@ -49,10 +94,46 @@ Game::Game(int mazeWidth, int mazeHeight) : Game(mazeWidth, mazeHeight, true) {}
  ** Pre-Conditions: none. 
  ** Post-Conditions: none.
  ****************************************************************************************/
-Game::Game(int mazeWidth, int mazeHeight, bool tutorial) : maze(Maze(mazeWidth, mazeHeight)), 
-	hudWin(nullptr), mazeWin(nullptr), alertWin(nullptr), mazeWinRows(0), cameraCol(0), 
-	cameraRow(0), hudRightCol(GAME_HUD_WIDTH_1), alertOption(0), alertNumOptions(0), 
-	askTutorial(tutorial) {}
+Game::Game(int mazeWidth, int mazeHeight, bool tutorial) : 
+	Game(Replay(mazeWidth, mazeHeight, CmdArgs::getSeed(), 
+				OptionsPanel::loadMazeOptions()), tutorial, false) {}
+
+/*****************************************************************************************
+ ** Function: Game (constructor)
+ ** Description: Makes a new Game object that plays back a replay instead of being 
+ **				 played.
+ ** Parameters: gameReplay (const Replay&) - the replay to watch
+ ** Pre-Conditions: none. 
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Game::Game(const Replay& gameReplay) : Game(gameReplay, false, true) {}
+
+/*****************************************************************************************
+ ** Function: Game (constructor)
+ ** Description: Makes a new Game object on the maze from a replay.
+ ** Parameters: gameReplay (const Replay&) - the replay with the maze to play on (and the
+ **					turns to play back, if replaying)
+ **				tutorial (bool) - whether or not to show an alert asking if the user wants
+ **					any tutorials
+ **				replaying (bool) - whether to watch the replay instead of playing (and 
+ **					adding to it)
+ ** Pre-Conditions: none. 
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Game::Game(const Replay& gameReplay, bool tutorial, bool replaying) : 
+	hudWin(nullptr), mazeWin(nullptr), alertWin(nullptr), mazePad(nullptr), 
+	maze(gameReplay.getWidth(), gameReplay.getHeight(), gameReplay.getSeed(), 
+		 gameReplay.getOptions()), 
+	replay(gameReplay), replaying(replaying), turn(0), squareSize(0), 
+	stampSquareSized(nullptr), mipMap(maze.getTiles()), showMinimap(false), 
+	mazeWinRows(0), cameraRow(0), cameraCol(0), hudRightCol(GAME_HUD_WIDTH_1), 
+	alertOption(0), alertNumOptions(0), 
+	askTutorial(tutorial), tickMs(CmdArgs::getTickMs()), queuedTurn(' '), 
+	autoplay(tickMs > 0), turnsPerTick(1), finishing(false) {
+	setSquareSize(GAME_SQUARE_SIZE);
+	mipMap.build();
+	if (replaying) replay.makeSnapshots(maze);
+}
 
 /*****************************************************************************************
  ** Function: ~Game (destructor)
@@ -62,9 +143,14 @@ Game::Game(int mazeWidth, int mazeHeight, bool tutorial) : maze(Maze(mazeWidth,
  ** Post-Conditions: none.
  ****************************************************************************************/
 Game::~Game() {
+	// a game where nothing happened isn't worth replacing the last one for
+	if (!replaying && turn > 0 && CmdArgs::getRecordFile() != "") 
+		replay.save(CmdArgs::getRecordFile());
+
 	if (hudWin != nullptr) delwin(hudWin);
 	if (mazeWin != nullptr) delwin(mazeWin);
 	if (alertWin != nullptr) delwin(alertWin);
+	if (mazePad != nullptr) delwin(mazePad);
 }
 
 /*****************************************************************************************
@@ -98,25 +184,93 @@ void Game::init() {
  ** Function: loop
  ** Description: Input loop for the program when showing a Game panel. Only returns when
  **				 there's a new panel to show (which is the return value), or nullptr if 
- **				 it's time to terminate the program.
+ **				 it's time to terminate the program. Every input that's already waiting 
+ **				 gets handled before the screen is updated (like when holding down a key),
+ **				 so the screen doesn't fall behind.
  ** Parameters: none.
  ** Pre-Conditions: init() was already called.
  ** Post-Conditions: none.
  ****************************************************************************************/
 Panel* Game::loop() {
+	if (tickMs > 0 || maze.getUsingAI() || replaying) return loopRealTime();
+
+	Panel* p = nullptr;
+	int chr = ERR;
+	while (true) {
+		if (chr == ERR) {
+			// caught up, so everything drawn since the last frame goes out together
+			if (!windowDisabled) commitFrame();
+			chr = getInput(-1);
+		}
+
+		if (chr == KEY_RESIZE) resizeHandler();
+		if (!windowDisabled) {
+			if (alertWin != nullptr) {
+				if (handleInputAlert(chr, p)) break;
+			}
+			else {
+				if (handleInputMaze(chr, p)) break;
+			}
+		}
+
+		chr = getInput(0);
+	}
+	return p;
+}
+
+/*****************************************************************************************
+ ** Function: loopRealTime
+ ** Description: Input loop for real-time mode (--tick) and for the AI. Everybody moves 
+ **				 once a tick whether the user pressed anything or not, using the last 
+ **				 move they pressed during the tick. The screen is only updated once a 
+ **				 tick, and in between it just waits for input until the next tick is 
+ **				 due. Nothing moves while an alert is showing, while the AI is paused, or
+ **				 while the window is too small (where it works just like loop()).
+ ** Parameters: none.
+ ** Pre-Conditions: init() was already called.
+ ** Post-Conditions: Same as loop().
+ ****************************************************************************************/
+Panel* Game::loopRealTime() {
+	using namespace std::chrono;
+
 	Panel* p = nullptr;
-	int chr;
+	bool paused = true;
 	while (true) {
-		if (windowDisabled) chr = getch();
-		else if (alertWin != nullptr) chr = wgetch(alertWin);
-		else chr = wgetch(mazeWin);
+		int chr;
+		if (windowDisabled || alertWin != nullptr || !getTicking()) {
+			// waiting on the user, so catch up on their inputs and then there's no hurry
+			chr = getInput(0);
+			if (chr == ERR) {
+				if (!windowDisabled) commitFrame();
+				chr = getInput(-1);
+			}
+			paused = true;
+		}
+		else {
+			// start counting again from when it stopped
+			if (paused) {
+				nextTick = steady_clock::now() + milliseconds(getTickInterval());
+				queuedTurn = ' ';
+				paused = false;
+			}
+
+			if (steady_clock::now() >= nextTick) tick();
+			long long left = duration_cast<milliseconds>(nextTick - 
+														 steady_clock::now()).count();
+			chr = getInput((int) std::max(left, 0LL));
+			if (chr == ERR) continue;
+		}
 
 		if (chr == KEY_RESIZE) resizeHandler();
+		// only a resize can bring the window back, until then nothing is drawn
 		if (windowDisabled) continue;
 
 		if (alertWin != nullptr) {
 			if (handleInputAlert(chr, p)) break;
 		}
+		else if (getTicking() && isTurnInput(chr)) {
+			if (!maze.getUsingAI() && !replaying) queuedTurn = chr;
+		}
 		else {
 			if (handleInputMaze(chr, p)) break;
 		}
@@ -124,6 +278,117 @@ Panel* Game::loop() {
 	return p;
 }
 
+/*****************************************************************************************
+ ** Function: tick
+ ** Description: Takes the turns for one tick and puts the frame on the screen. That's 
+ **				 one turn, unless the AI or a replay is fast forwarding (turnsPerTick 
+ **				 turns) or finishing (as many as fit in GAME_FINISH_FRAME_MS). Only the 
+ **				 last turn is drawn, the others just keep the pad and minimap up to date.
+ ** Parameters: none.
+ ** Pre-Conditions: No alert is showing.
+ ** Post-Conditions: nextTick is after now (or now, when finishing).
+ ****************************************************************************************/
+void Game::tick() {
+	using namespace std::chrono;
+
+	int input = queuedTurn;
+	queuedTurn = ' ';
+
+	auto start = steady_clock::now();
+	bool ended = false, stop = getReplayOver();
+	for (int turns = 1; !stop; turns++) {
+		ended = takeTurn(replaying ? replay.getInput(turn) : input);
+		// a replay stops where it was recorded to, even if the game didn't end there
+		stop = ended || getReplayOver();
+
+		bool more = finishing ? steady_clock::now() - start < 
+								milliseconds(GAME_FINISH_FRAME_MS) 
+							  : turns < turnsPerTick;
+		if (stop || !more) break;
+		updateChanges();
+	}
+
+	if (stop) {
+		autoplay = finishing = false;
+		drawHudAutoplay();
+	}
+	if (!ended) {
+		drawChanges();
+		redrawHudLeft();
+		refreshMaze();
+	}
+	commitFrame();
+
+	// if a tick took too long, skip ahead instead of rushing to catch up
+	auto now = steady_clock::now();
+	nextTick += milliseconds(getTickInterval());
+	if (nextTick < now) nextTick = now + milliseconds(getTickInterval());
+}
+
+/*****************************************************************************************
+ ** Function: getTicking
+ ** Description: Checks if everybody should be moving by themselves right now (ignoring 
+ **				 alerts).
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Game::getTicking() const {
+	if (maze.getUsingAI() || replaying) return autoplay || finishing;
+	return tickMs > 0;
+}
+
+/*****************************************************************************************
+ ** Function: getTickInterval
+ ** Description: Gets how long a tick is right now in milliseconds.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int Game::getTickInterval() const {
+	if (finishing) return 0;
+	if (tickMs > 0) return tickMs;
+	return GAME_AUTOPLAY_MS;
+}
+
+/*****************************************************************************************
+ ** Function: isTurnInput
+ ** Description: Checks if an input is one that takes a turn (moving, using a skill, or 
+ **				 waiting).
+ ** Parameters: chr (int) - the input to check
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Game::isTurnInput(int chr) {
+	switch(chr) {
+		case 'p':
+		case 'w': case KEY_UP:
+		case 'a': case KEY_LEFT:
+		case 's': case KEY_DOWN:
+		case 'd': case KEY_RIGHT:
+		case ' ':
+		case '\n': case '\r': case KEY_ENTER:
+			return true;
+	}
+	return false;
+}
+
+/*****************************************************************************************
+ ** Function: getInput
+ ** Description: Gets the next input from whichever window has focus.
+ ** Parameters: delay (int) - how many milliseconds to wait for an input if there isn't 
+ **					one yet, or -1 to wait as long as it takes
+ ** Pre-Conditions: The windows have already been initialized (unless windowDisabled).
+ ** Post-Conditions: Returns ERR if there wasn't an input in time.
+ ****************************************************************************************/
+int Game::getInput(int delay) {
+	WINDOW* win = stdscr;
+	if (!windowDisabled) win = alertWin != nullptr ? alertWin : mazeWin;
+
+	wtimeout(win, delay);
+	return wgetch(win);
+}
+
 /*****************************************************************************************
  ** Function: resizeHandler
  ** Description: Called when the window has been resized. Updates some internal variables
@@ -167,25 +432,158 @@ bool Game::handleInputMaze(int chr, Panel*& nextPanel) {
 		case 'l':
 			moveCameraLeftRight(false);
 			break;
+		case 'z':
+			cycleZoom();
+			break;
+		case 'm':
+			showMinimap = !showMinimap;
+			// the pad goes back on top of mazeWin, which has to be blank again
+			if (!showMinimap && mazePad != nullptr) {
+				werase(mazeWin);
+				wnoutrefresh(mazeWin);
+			}
+			break;
+		case 'r':
+		case 'f':
+		case 'e':
+			if (maze.getUsingAI() || replaying) handleInputAutoplay(chr);
+			return false;
+		case ',': case '.':
+		case '[': case ']':
+			if (replaying) handleInputReplay(chr);
+			return false;
 		case 'p':
 		case 'w': case KEY_UP:
 		case 'a': case KEY_LEFT:
 		case 's': case KEY_DOWN:
 		case 'd': case KEY_RIGHT:
-			if (maze.getUsingAI()) return false;
+			if (maze.getUsingAI() || replaying) return false;
 		case ' ':
 		case '\n': case '\r': case KEY_ENTER:
-			// counts as a turn, need to pass to the maze
+			// a replay has its own turns, which just get stepped through
+			if (replaying) {
+				handleInputReplay('.');
+				return false;
+			}
+			// counts as a turn, need to pass to the maze (only redraws what changed)
 			if (takeTurn(chr)) return false;
-			break;
+			drawChanges();
+			redrawHudLeft();
+			refreshMaze();
+			return false;
 	}
 
 	// HUD is already refreshed in the redraw method
 	drawMaze();
 	redrawHudLeft();
+	refreshMaze();
 	return false;
 }
 
+/*****************************************************************************************
+ ** Function: handleInputAutoplay
+ ** Description: Handles the inputs that control the AI (or a replay) playing by itself: 
+ **				 R to play or
+ **				 pause, F to take 10 times as many turns between frames (back to 1 after
+ **				 GAME_MAX_FAST_FORWARD), and E to run through to the end of the game (or
+ **				 stop doing that).
+ ** Parameters: chr (int) - the character the user just inputted
+ ** Pre-Conditions: The AI is playing.
+ ** Post-Conditions: The autoplay status in the HUD is up to date.
+ ****************************************************************************************/
+void Game::handleInputAutoplay(int chr) {
+	switch(chr) {
+		case 'r':
+			if (autoplay || finishing) autoplay = finishing = false;
+			else autoplay = true;
+			break;
+		case 'f':
+			turnsPerTick = turnsPerTick >= GAME_MAX_FAST_FORWARD ? 1 : turnsPerTick * 10;
+			break;
+		case 'e':
+			finishing = !finishing && !getReplayOver();
+			// the next frame doesn't have to wait for the current tick to run out
+			if (finishing) nextTick = std::chrono::steady_clock::now();
+			break;
+	}
+	drawHudAutoplay();
+}
+
+/*****************************************************************************************
+ ** Function: handleInputReplay
+ ** Description: Handles the inputs for moving around in a replay: comma and period to go
+ **				 back or forward a turn, and the brackets to go back or forward 
+ **				 REPLAY_SEEK_TURNS turns.
+ ** Parameters: chr (int) - the character the user just inputted
+ ** Pre-Conditions: A replay is being watched.
+ ** Post-Conditions: Everything that changed has been redrawn.
+ ****************************************************************************************/
+void Game::handleInputReplay(int chr) {
+	switch(chr) {
+		case ',':
+			seekReplay(turn - 1);
+			break;
+		case '.':
+			stepReplay();
+			break;
+		case '[':
+			seekReplay(turn - REPLAY_SEEK_TURNS);
+			break;
+		case ']':
+			seekReplay(turn + REPLAY_SEEK_TURNS);
+			break;
+	}
+}
+
+/*****************************************************************************************
+ ** Function: getReplayOver
+ ** Description: Checks if a replay is being watched and there are no more turns in it.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Game::getReplayOver() const {
+	return replaying && turn >= replay.getNumTurns();
+}
+
+/*****************************************************************************************
+ ** Function: stepReplay
+ ** Description: Plays the next turn of the replay being watched (if there is one), only 
+ **				 redrawing what changed like a normal turn.
+ ** Parameters: none.
+ ** Pre-Conditions: A replay is being watched.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::stepReplay() {
+	if (getReplayOver()) return;
+
+	if (!takeTurn(replay.getInput(turn))) {
+		drawChanges();
+		redrawHudLeft();
+		refreshMaze();
+	}
+}
+
+/*****************************************************************************************
+ ** Function: seekReplay
+ ** Description: Moves the replay being watched to another turn, and redraws everything
+ **				 since that can change anything.
+ ** Parameters: target (int) - the turn to go to (kept inside the replay)
+ ** Pre-Conditions: A replay is being watched.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::seekReplay(int target) {
+	replay.seek(maze, turn, target);
+
+	mipMap = TileMipMap(maze.getTiles());
+	mipMap.build();
+	if (mazePad != nullptr) drawPad();
+
+	drawMaze();
+	redrawHudLeft();
+	refreshMaze();
+}
+
 /*****************************************************************************************
  ** Function: handleInputAlert
  ** Description: Handles user input when they're focused on an alert.
@@ -298,13 +696,13 @@ bool Game::handleEnterAlert(Panel*& nextPanel) {
 void Game::draw() {
 	initHudWin();
 	drawHud();
-	wrefresh(hudWin);
+	wnoutrefresh(hudWin);
 
 	initCamera();
 	
 	initMazeWin();
 	drawMaze();
-	wrefresh(mazeWin);
+	refreshMaze();
 
 	if (alertWin != nullptr) {
 		initAlertWin();
@@ -344,6 +742,31 @@ void Game::initMazeWin() {
 	mazeWin = newwin(0, 0, GAME_HUD_HEIGHT, 0);
 	intrflush(mazeWin, true);
 	keypad(mazeWin, true);
+
+	if (mazePad == nullptr && CmdArgs::getUsePad()) initMazePad();
+	// mazeWin is only there for input now, so wgetch() shouldn't ever draw it on the pad
+	// (which it would if mazeWin was never refreshed)
+	if (mazePad != nullptr) wnoutrefresh(mazeWin);
+}
+
+/*****************************************************************************************
+ ** Function: initMazePad
+ ** Description: Makes the pad for the whole maze and draws everything to it. The pad 
+ **				 doesn't depend on the screen size, so this only happens once. 
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: mazePad is still null if the maze was too big for a pad (the maze 
+ **					 is drawn straight to mazeWin then).
+ ****************************************************************************************/
+void Game::initMazePad() {
+	// the border is one past the maze on the top/left and two past on the bottom/right
+	long long rows = squareSize*(long long) maze.getMazeHeight() + 3;
+	long long cols = squareSize*(long long) maze.getMazeWidth() + 3;
+	if (rows*cols > GAME_PAD_MAX_CELLS) return;
+
+	mazePad = newpad(rows, cols);
+	if (mazePad == nullptr) return;
+	drawPad();
 }
 
 /*****************************************************************************************
@@ -400,8 +823,12 @@ void Game::drawHud() {
  ****************************************************************************************/
 void Game::drawHudLeft() {
 	mvwaddstr(hudWin, 0, 0, GAME_HUD_TEXT_QUIT);
+	// so the same game can be played again with --seed (cut off before the right side)
+	mvwaddnstr(hudWin, 1, 0, (GAME_HUD_TEXT_SEED + std::to_string(maze.getSeed())).c_str(), 
+			   hudRightCol - 1);
 	mvwaddstr(hudWin, 2, 0, (GAME_HUD_TEXT_SKILLS + std::to_string(maze.getNumSkills())).c_str());
-	mvwaddstr(hudWin, 3, 0, (GAME_HUD_TEXT_TA + TA::getStatus()).c_str());
+	mvwaddstr(hudWin, 3, 0, (GAME_HUD_TEXT_TA + maze.getTAStatus()).c_str());
+	if (replaying) drawHudTurn();
 }
 
 /*****************************************************************************************
@@ -418,12 +845,31 @@ void Game::redrawHudLeft() {
 	for (int i = sizeof(GAME_HUD_TEXT_SKILLS)  - 1 + str.length(); i < hudRightCol; i++) 
 		waddch(hudWin, ' ');
 
-	str = TA::getStatus();
+	str = maze.getTAStatus();
 	mvwaddstr(hudWin, 3, sizeof(GAME_HUD_TEXT_TA) - 1, str.c_str());
 	for (int i = sizeof(GAME_HUD_TEXT_TA) - 1 + str.length(); i < hudRightCol; i++) 
 		waddch(hudWin, ' ');
 
-	wrefresh(hudWin);
+	if (replaying) drawHudTurn();
+	wnoutrefresh(hudWin);
+}
+
+/*****************************************************************************************
+ ** Function: drawHudTurn
+ ** Description: Draws which turn of the replay is showing, after the quit text at the top
+ **				 of the left half of the HUD.
+ ** Parameters: none.
+ ** Pre-Conditions: hudWin has already been initialized.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::drawHudTurn() {
+	int col = sizeof(GAME_HUD_TEXT_QUIT) + 2;
+	std::string str = GAME_HUD_TEXT_TURN + std::to_string(turn) + "/" + 
+					  std::to_string(replay.getNumTurns());
+
+	// cut off before the right side, like the seed
+	mvwaddnstr(hudWin, 0, col, str.c_str(), std::max(hudRightCol - 1 - col, 0));
+	for (int i = col + str.length(); i < hudRightCol; i++) waddch(hudWin, ' ');
 }
 
 /*****************************************************************************************
@@ -434,8 +880,16 @@ void Game::redrawHudLeft() {
  ** Post-Conditions: none.
  ****************************************************************************************/
 void Game::drawHudRight() {
-	if (maze.getUsingAI()) {
+	if (replaying) {
+		drawHudAutoplay();
+		mvwaddstr(hudWin, 1, hudRightCol, GAME_HUD_TEXT_REPLAY);
+		mvwaddstr(hudWin, 2, hudRightCol, GAME_HUD_TEXT_AUTO);
+		mvwaddstr(hudWin, 3, hudRightCol, GAME_HUD_TEXT_CAMERA);
+	}
+	else if (maze.getUsingAI()) {
+		drawHudAutoplay();
 		mvwaddstr(hudWin, 1, hudRightCol, GAME_HUD_TEXT_AI);
+		mvwaddstr(hudWin, 2, hudRightCol, GAME_HUD_TEXT_AUTO);
 		mvwaddstr(hudWin, 3, hudRightCol, GAME_HUD_TEXT_CAMERA);
 	}
 	else {
@@ -447,141 +901,492 @@ void Game::drawHudRight() {
 
 /*****************************************************************************************
  ** Function: drawMaze
- ** Description: Draws the entire maze.
+ ** Description: Draws the entire maze. Everything is put together in frame first, then 
+ **				 each row of the window gets written with one call.
  ** Parameters: none.
  ** Pre-Conditions: mazeWin has already been initialized.
- ** Post-Conditions: none.
+ ** Post-Conditions: frame matches what's in mazeWin.
  ****************************************************************************************/
 void Game::drawMaze() {
-	werase(mazeWin);
+	if (showMinimap) {
+		drawMinimap();
+		return;
+	}
+
+	// the pad already has everything on it, refreshMaze() picks the part to show
+	if (mazePad != nullptr) return;
+
+	frame.assign(mazeWinRows*COLS, ' ');
 	
 	// loop through the relevant squares 
-	int minRow = std::max(cameraRow/GAME_SQUARE_SIZE, 0);
-	int maxRow = std::min((cameraRow+mazeWinRows)/GAME_SQUARE_SIZE, maze.getMazeHeight() - 1);
-	int minCol = std::max(cameraCol/GAME_SQUARE_SIZE, 0); 
-	int maxCol = std::min((cameraCol + COLS)/GAME_SQUARE_SIZE, maze.getMazeWidth() - 1);
+	int minRow = std::max(cameraRow/squareSize, 0);
+	int maxRow = std::min((cameraRow+mazeWinRows)/squareSize, maze.getMazeHeight() - 1);
+	int minCol = std::max(cameraCol/squareSize, 0); 
+	int maxCol = std::min((cameraCol + COLS)/squareSize, maze.getMazeWidth() - 1);
+	const MazeArea& seen = maze.getVisibleArea();
 	for (int r = minRow; r <= maxRow; r++) {
+		// rows outside of what the student can see are all fog
+		bool rowSeen = seen.containsRow(r);
 		for (int c = minCol; c <= maxCol; c++) {
-			drawSquare(r, c);
+			// only squares in the area can be behind a wall (with line of sight fog)
+			drawSquare(r, c, !rowSeen || c < seen.left || c > seen.right || 
+					   maze.getInFog(r, c));
 		}
 	}
 
 	drawMazeBorder();
 
-	// draw all people and check for relevancy
-	for (int i = maze.getNumPeople() - 1; i >= 0; i--) {
-		if (!maze.getInFog(i)) drawPerson(maze.getPerson(i));
+	for (int row = 0; row < mazeWinRows; row++) 
+		mvwaddchnstr(mazeWin, row, 0, &frame[row*COLS], COLS);
+}
+
+/*****************************************************************************************
+ ** Function: drawHudAutoplay
+ ** Description: Draws whether the AI (or a replay) is playing by itself (and how fast) 
+ **				 in the top row of the right half of the HUD.
+ ** Parameters: none.
+ ** Pre-Conditions: hudWin has already been initialized.
+ ** Post-Conditions: hudWin has been refreshed.
+ ****************************************************************************************/
+void Game::drawHudAutoplay() {
+	std::string str = replaying ? GAME_HUD_TEXT_REPLAY_NAME : GAME_HUD_TEXT_AI_NAME;
+	if (finishing) str += GAME_HUD_TEXT_FINISHING;
+	else if (autoplay) str += GAME_HUD_TEXT_PLAYING + std::to_string(turnsPerTick);
+	else str += GAME_HUD_TEXT_PAUSED;
+
+	mvwaddstr(hudWin, 0, hudRightCol, str.c_str());
+	wclrtoeol(hudWin);
+	wnoutrefresh(hudWin);
+}
+
+/*****************************************************************************************
+ ** Function: drawChanges
+ ** Description: Redraws only the squares that changed in the last turn, instead of the 
+ **				 whole maze. The camera doesn't move during a turn, so nothing else on the
+ **				 screen can be out of date.
+ ** Parameters: none.
+ ** Pre-Conditions: mazeWin has already been initialized and the whole maze was drawn 
+ **					before the turn.
+ ** Post-Conditions: frame matches what's in mazeWin (or mazePad matches the maze).
+ ****************************************************************************************/
+void Game::drawChanges() {
+	updateChanges();
+
+	// the minimap is small enough to just redraw
+	if (showMinimap) drawMinimap();
+}
+
+/*****************************************************************************************
+ ** Function: updateChanges
+ ** Description: Same as drawChanges(), except that the minimap isn't redrawn. For turns
+ **				 that won't be shown (when more than one turn goes by between frames).
+ ** Parameters: none.
+ ** Pre-Conditions: Same as drawChanges().
+ ** Post-Conditions: Same as drawChanges(), except for the minimap.
+ ****************************************************************************************/
+void Game::updateChanges() {
+	const std::vector<int>& changed = maze.getChangedSquares();
+	int width = maze.getMazeWidth();
+
+	// skills only get picked up where the student moved, which is always in changed
+	for (int i = 0; i < changed.size(); i++) 
+		mipMap.update(changed[i] / width, changed[i] % width);
+
+	// everything goes on the pad, even what's off screen right now
+	if (mazePad != nullptr) {
+		for (int i = 0; i < changed.size(); i++) 
+			drawPadSquare(changed[i] / width, changed[i] % width);
+	}
+
+	// the minimap is over mazeWin, so there's nothing to draw there
+	if (showMinimap || mazePad != nullptr) return;
+
+	// same bounds as drawMaze()
+	int minRow = std::max(cameraRow/squareSize, 0);
+	int maxRow = std::min((cameraRow+mazeWinRows)/squareSize, maze.getMazeHeight() - 1);
+	int minCol = std::max(cameraCol/squareSize, 0); 
+	int maxCol = std::min((cameraCol + COLS)/squareSize, width - 1);
+	for (int i = 0; i < changed.size(); i++) {
+		int r = changed[i] / width, c = changed[i] % width;
+		if (r < minRow || r > maxRow || c < minCol || c > maxCol) continue;
+
+		drawSquare(r, c, maze.getInFog(r, c));
+		flushSquare(r, c);
 	}
 }
 
 /*****************************************************************************************
  ** Function: drawSquare
- ** Description: Draws a single square in the maze.
+ ** Description: Draws a single square in the maze along with anybody standing on it into
+ **				 frame, clipped to the window.
  ** Parameters: mazeRow (int) - the row of the square to draw
  **				mazeCol (int) - the column of the square to draw
- ** Pre-Conditions: mazeWin has already been initialized.
+ **				inFog (bool) - whether the square is in fog
+ ** Pre-Conditions: frame is the size of mazeWin.
  ** Post-Conditions: none.
  ****************************************************************************************/
-void Game::drawSquare(int mazeRow, int mazeCol) {
-	int currCol = mazeCol*GAME_SQUARE_SIZE - cameraCol, currRow = mazeRow*GAME_SQUARE_SIZE - cameraRow;
-	
-	const MazeLocation* loc = maze.getLoc(mazeRow, mazeCol);
-	if (loc == nullptr) return;
-	int ch = loc->getDisplayChar(maze.getInFog(mazeRow, mazeCol));
-
-	for (int i = 0; i < GAME_SQUARE_SIZE; i++) {
-		for (int j = 0; j < GAME_SQUARE_SIZE; j++) {
-			if (currRow + i >= 0 && currCol + j >= 0 
-				&& currRow + i < mazeWinRows && currCol + j < COLS) {
-				mvwaddch(mazeWin, currRow + i, currCol + j, ch);
-			}
-		}
+void Game::drawSquare(int mazeRow, int mazeCol, bool inFog) {
+	if (!maze.getTiles().inBounds(mazeRow, mazeCol)) return;
+
+	chtype stamp[GAME_MAX_SQUARE_SIZE*GAME_MAX_SQUARE_SIZE];
+	stampSquare(mazeRow, mazeCol, inFog, stamp);
+
+	// top left display row/col 
+	int top = mazeRow*squareSize - cameraRow, left = mazeCol*squareSize - cameraCol;
+	int firstRow = std::max(top, 0), lastRow = std::min(top + squareSize, mazeWinRows);
+	int firstCol = std::max(left, 0), lastCol = std::min(left + squareSize, COLS);
+
+	for (int row = firstRow; row < lastRow; row++) {
+		const chtype* stampRow = stamp + (row - top)*squareSize;
+		std::copy(stampRow + firstCol - left, stampRow + lastCol - left, 
+				  &frame[row*COLS + firstCol]);
 	}
 }
 
 /*****************************************************************************************
- ** Function: drawPerson
- ** Description: Draws a single person in the maze.
- ** Parameters: person (const MazePerson*) - the person to draw
- ** Pre-Conditions: mazeWin has already been initialized.
+ ** Function: flushSquare
+ ** Description: Writes a single square from frame to the window, one call per row.
+ ** Parameters: mazeRow (int) - the row of the square to write
+ **				mazeCol (int) - the column of the square to write
+ ** Pre-Conditions: mazeWin has already been initialized and the square was drawn to 
+ **					frame.
  ** Post-Conditions: none.
  ****************************************************************************************/
-void Game::drawPerson(const MazePerson* person) {
-	// draws a plus pattern GAME_SQUARE_SIZE/3 wide centered on the square 
-	// width of the plus pattern 
-	int width = GAME_SQUARE_SIZE / 3;
+void Game::flushSquare(int mazeRow, int mazeCol) {
+	int top = mazeRow*squareSize - cameraRow, left = mazeCol*squareSize - cameraCol;
+	int firstRow = std::max(top, 0), lastRow = std::min(top + squareSize, mazeWinRows);
+	int firstCol = std::max(left, 0), lastCol = std::min(left + squareSize, COLS);
+	if (firstCol >= lastCol) return;
+
+	for (int row = firstRow; row < lastRow; row++) 
+		mvwaddchnstr(mazeWin, row, firstCol, &frame[row*COLS + firstCol], lastCol - firstCol);
+}
 
-	// top left display row/col 
-	int row = person->getRow()*GAME_SQUARE_SIZE - cameraRow;
-	int col = person->getCol()*GAME_SQUARE_SIZE - cameraCol;
-	int ch = person->getDisplayChar();
-
-	for (int i = 0; i < width; i++) {
-		int currRow, currCol;
-		// horizontal part (row is const)
-		currRow = row + width + i;
-		for (int j = 0; j < GAME_SQUARE_SIZE; j++) {
-			currCol = col + j;
-			if (currRow >= 0 && currCol >= 0 && currRow < mazeWinRows && currCol < COLS) {
-				mvwaddch(mazeWin, currRow, currCol, ch);
-			}
-		}
+/*****************************************************************************************
+ ** Function: stampSquare
+ ** Description: Fills in what a single square looks like on screen at the current zoom.
+ ** Parameters: mazeRow (int) - the row of the square
+ **				mazeCol (int) - the column of the square
+ **				inFog (bool) - whether the square is in fog
+ **				stamp (chtype*) - output parameter for the square, row by row
+ ** Pre-Conditions: stamp has room for squareSize*squareSize chars and the 
+ **					square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::stampSquare(int mazeRow, int mazeCol, bool inFog, chtype* stamp) {
+	(this->*stampSquareSized)(mazeRow, mazeCol, inFog, stamp);
+}
 
-		// vertical part (col is const)
-		currCol = col + width + i;
-		for (int j = 0; j < GAME_SQUARE_SIZE; j++) {
-			currRow = row + j;
-			if (currRow >= 0 && currCol >= 0 && currRow < mazeWinRows && currCol < COLS) {
-				mvwaddch(mazeWin, currRow, currCol, ch);
-			}
-		}
+/*****************************************************************************************
+ ** Function: stampSquareAt
+ ** Description: Fills in what a single square looks like on screen when it's SIZE chars
+ **				 on a side, people included (in the order TAs, then the instructor, then 
+ **				 the student on top). 
+ ** Parameters: mazeRow (int) - the row of the square
+ **				mazeCol (int) - the column of the square
+ **				inFog (bool) - whether the square is in fog
+ **				stamp (chtype*) - output parameter for the square, row by row
+ ** Pre-Conditions: stamp has room for SIZE*SIZE chars and the square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+template<int SIZE> void Game::stampSquareAt(int mazeRow, int mazeCol, bool inFog, 
+											 chtype* stamp) {
+	chtype ch = maze.getTiles().getDisplayChar(mazeRow, mazeCol, inFog);
+	std::fill(stamp, stamp + SIZE*SIZE, ch);
+
+	// the student can't be in fog, everyone else is hidden by it
+	if (!inFog) {
+		if (maze.getTAs().getCountAt(mazeRow, mazeCol) > 0) 
+			stampPerson<SIZE>(stamp, TAGroup::getDisplayChar(maze.getTAsAppeased()));
+		if (maze.getTiles().hasInstructor(mazeRow, mazeCol)) 
+			stampPerson<SIZE>(stamp, maze.getInstructor()->getDisplayChar());
 	}
+
+	const IntrepidStudent* student = maze.getStudent();
+	if (student->getRow() == mazeRow && student->getCol() == mazeCol) 
+		stampPerson<SIZE>(stamp, student->getDisplayChar());
 }
 
 /*****************************************************************************************
  ** Function: drawMazeBorder
- ** Description: Draws the border of the maze, if necessary
+ ** Description: Draws the border of the maze into frame, if necessary
  ** Parameters: none.
- ** Pre-Conditions: mazeWin has already been initialized.
+ ** Pre-Conditions: frame is the size of mazeWin.
  ** Post-Conditions: none.
  ****************************************************************************************/
 void Game::drawMazeBorder() {
 	// display rows for top/bottom borders
-	int top = -1 - cameraRow, bottom = GAME_SQUARE_SIZE*maze.getMazeHeight() + 1 - cameraRow;
+	int top = -1 - cameraRow, bottom = squareSize*maze.getMazeHeight() + 1 - cameraRow;
 	// display cols for left/right borders
-	int left = -1 - cameraCol, right = GAME_SQUARE_SIZE*maze.getMazeWidth() + 1 - cameraCol;
+	int left = -1 - cameraCol, right = squareSize*maze.getMazeWidth() + 1 - cameraCol;
 
 	// draw checks
 	if (top >= 0) {
 		// top border
 		for (int i = std::max(left+1, 0); i < std::min(right, COLS); i++) 
-			mvwaddch(mazeWin, top, i, ACS_HLINE);
+			frame[top*COLS + i] = ACS_HLINE;
 	}
 	if (left >= 0) {
 		// left border
 		for (int i = std::max(top+1, 0); i < std::min(bottom, mazeWinRows); i++) 
-			mvwaddch(mazeWin, i, left, ACS_VLINE);
+			frame[i*COLS + left] = ACS_VLINE;
 		
 		// left corner checks
-		if (top >= 0) mvwaddch(mazeWin, top, left, ACS_ULCORNER);
-		if (bottom < mazeWinRows) mvwaddch(mazeWin, bottom, left, ACS_LLCORNER);
+		if (top >= 0) frame[top*COLS + left] = ACS_ULCORNER;
+		if (bottom < mazeWinRows) frame[bottom*COLS + left] = ACS_LLCORNER;
 	}
 	if (bottom < mazeWinRows) {
 		// bottom border
 		for (int i = std::max(left+1, 0); i < std::min(right, COLS); i++) 
-			mvwaddch(mazeWin, bottom, i, ACS_HLINE);
+			frame[bottom*COLS + i] = ACS_HLINE;
 	}
 	if (right < COLS) {
 		// right border
 		for (int i = std::max(top+1, 0); i < std::min(bottom, mazeWinRows); i++) 
-			mvwaddch(mazeWin, i, right, ACS_VLINE);
+			frame[i*COLS + right] = ACS_VLINE;
 		
 		// right corner checks
-		if (top >= 0) mvwaddch(mazeWin, top, right, ACS_URCORNER);
-		if (bottom < mazeWinRows) mvwaddch(mazeWin, bottom, right, ACS_LRCORNER);
+		if (top >= 0) frame[top*COLS + right] = ACS_URCORNER;
+		if (bottom < mazeWinRows) frame[bottom*COLS + right] = ACS_LRCORNER;
+	}
+}
+
+/*****************************************************************************************
+ ** Function: drawPad
+ ** Description: Draws the entire maze and its border to the pad, one call per row. Pad 
+ **				 rows/cols are display rows/cols plus one (for the top/left border).
+ ** Parameters: none.
+ ** Pre-Conditions: mazePad has already been initialized.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::drawPad() {
+	int padRows, padCols;
+	getmaxyx(mazePad, padRows, padCols);
+
+	// one maze row worth of pad rows
+	std::vector<chtype> band(squareSize*padCols, ' ');
+	chtype stamp[GAME_MAX_SQUARE_SIZE*GAME_MAX_SQUARE_SIZE];
+
+	// top and bottom borders
+	std::fill(band.begin(), band.begin() + padCols, ACS_HLINE);
+	band[0] = ACS_ULCORNER;
+	band[padCols - 1] = ACS_URCORNER;
+	mvwaddchnstr(mazePad, 0, 0, &band[0], padCols);
+	band[0] = ACS_LLCORNER;
+	band[padCols - 1] = ACS_LRCORNER;
+	mvwaddchnstr(mazePad, padRows - 1, 0, &band[0], padCols);
+
+	// left/right borders (with the empty row/col before the bottom/right borders)
+	for (int i = 0; i < squareSize; i++) {
+		std::fill(band.begin() + i*padCols, band.begin() + (i + 1)*padCols, ' ');
+		band[i*padCols] = ACS_VLINE;
+		band[i*padCols + padCols - 1] = ACS_VLINE;
+	}
+	mvwaddchnstr(mazePad, padRows - 2, 0, &band[0], padCols);
+
+	// the squares only overwrite their own cols, so the borders stay put
+	const MazeArea& seen = maze.getVisibleArea();
+	for (int r = 0; r < maze.getMazeHeight(); r++) {
+		bool rowSeen = seen.containsRow(r);
+		for (int c = 0; c < maze.getMazeWidth(); c++) {
+			bool inFog = !rowSeen || c < seen.left || c > seen.right || maze.getInFog(r, c);
+			stampSquare(r, c, inFog, stamp);
+			for (int i = 0; i < squareSize; i++) {
+				std::copy(stamp + i*squareSize, stamp + (i + 1)*squareSize, 
+						  &band[i*padCols + 1 + c*squareSize]);
+			}
+		}
+		for (int i = 0; i < squareSize; i++) 
+			mvwaddchnstr(mazePad, 1 + r*squareSize + i, 0, &band[i*padCols], padCols);
+	}
+}
+
+/*****************************************************************************************
+ ** Function: drawPadSquare
+ ** Description: Draws a single square in the maze along with anybody standing on it to
+ **				 the pad.
+ ** Parameters: mazeRow (int) - the row of the square to draw
+ **				mazeCol (int) - the column of the square to draw
+ ** Pre-Conditions: mazePad has already been initialized.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::drawPadSquare(int mazeRow, int mazeCol) {
+	if (!maze.getTiles().inBounds(mazeRow, mazeCol)) return;
+
+	chtype stamp[GAME_MAX_SQUARE_SIZE*GAME_MAX_SQUARE_SIZE];
+	stampSquare(mazeRow, mazeCol, maze.getInFog(mazeRow, mazeCol), stamp);
+
+	for (int i = 0; i < squareSize; i++) {
+		mvwaddchnstr(mazePad, 1 + mazeRow*squareSize + i, 1 + mazeCol*squareSize,
+					 stamp + i*squareSize, squareSize);
 	}
 }
 
+/*****************************************************************************************
+ ** Function: drawMinimap
+ ** Description: Draws the whole maze zoomed out (one char per block of squares) into 
+ **				 frame and mazeWin, centered with a border around it. Uses the most 
+ **				 detailed level of mipMap that fits in the window. 
+ ** Parameters: none.
+ ** Pre-Conditions: mazeWin has already been initialized.
+ ** Post-Conditions: frame matches what's in mazeWin.
+ ****************************************************************************************/
+void Game::drawMinimap() {
+	frame.assign(mazeWinRows*COLS, ' ');
+
+	// leave room for the border
+	int level = mipMap.getLevelFor(mazeWinRows - 2, COLS - 2);
+	int rows = mipMap.getRows(level), cols = mipMap.getCols(level);
+	int top = (mazeWinRows - rows)/2, left = (COLS - cols)/2;
+
+	for (int r = 0; r < rows; r++) {
+		for (int c = 0; c < cols; c++) 
+			frame[(top + r)*COLS + left + c] = getMinimapChar(level, r, c);
+	}
+
+	// people go on top, in the same order as on the maze (hidden by the fog too)
+	const TAGroup& tas = maze.getTAs();
+	chtype taChar = TAGroup::getDisplayChar(maze.getTAsAppeased());
+	if (maze.getUsingFog()) {
+		// only the few squares the student can see need checking for TAs
+		const MazeArea& seen = maze.getVisibleArea();
+		for (int r = seen.top; r <= seen.bottom; r++) {
+			for (int c = seen.left; c <= seen.right; c++) {
+				if (tas.getCountAt(r, c) > 0 && !maze.getInFog(r, c)) 
+					frame[(top + (r >> level))*COLS + left + (c >> level)] = taChar;
+			}
+		}
+	}
+	else {
+		for (int i = 0; i < tas.size(); i++) {
+			int row = tas.getRow(i) >> level, col = tas.getCol(i) >> level;
+			frame[(top + row)*COLS + left + col] = taChar;
+		}
+	}
+
+	const MazePerson* person = maze.getInstructor();
+	if (!maze.getInFog(person->getRow(), person->getCol())) {
+		frame[(top + (person->getRow() >> level))*COLS + left + (person->getCol() >> level)] = 
+			person->getDisplayChar();
+	}
+
+	person = maze.getStudent();
+	frame[(top + (person->getRow() >> level))*COLS + left + (person->getCol() >> level)] = 
+		person->getDisplayChar();
+
+	// border
+	int bottom = top + rows, right = left + cols;
+	for (int c = left; c < right; c++) {
+		frame[(top - 1)*COLS + c] = ACS_HLINE;
+		frame[bottom*COLS + c] = ACS_HLINE;
+	}
+	for (int r = top; r < bottom; r++) {
+		frame[r*COLS + left - 1] = ACS_VLINE;
+		frame[r*COLS + right] = ACS_VLINE;
+	}
+	frame[(top - 1)*COLS + left - 1] = ACS_ULCORNER;
+	frame[(top - 1)*COLS + right] = ACS_URCORNER;
+	frame[bottom*COLS + left - 1] = ACS_LLCORNER;
+	frame[bottom*COLS + right] = ACS_LRCORNER;
+
+	for (int row = 0; row < mazeWinRows; row++) 
+		mvwaddchnstr(mazeWin, row, 0, &frame[row*COLS], COLS);
+}
+
+/*****************************************************************************************
+ ** Function: getMinimapChar
+ ** Description: Gets the char for a single block of the minimap (without people). Any 
+ **				 skills in it show up first, otherwise it shows how many walls it has. 
+ ** Parameters: level (int) - the level of mipMap being drawn
+ **				row (int) - the row of the block
+ **				col (int) - the column of the block
+ ** Pre-Conditions: The block exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+chtype Game::getMinimapChar(int level, int row, int col) {
+	if (mipMap.getSkills(level, row, col) > 0) {
+		// with fog, only skills near the student can be seen
+		bool seen = !maze.getUsingFog();
+		int size = 1 << level;
+		const MazeArea& visible = maze.getVisibleArea();
+		int lastRow = std::min((row + 1)*size - 1, visible.bottom);
+		int lastCol = std::min((col + 1)*size - 1, visible.right);
+		for (int r = std::max(row*size, visible.top); !seen && r <= lastRow; r++) {
+			for (int c = std::max(col*size, visible.left); !seen && c <= lastCol; c++) 
+				seen = maze.getTiles().hasSkill(r, c) && !maze.getInFog(r, c);
+		}
+		if (seen) return DISPLAY_CHAR_SKILL | COLOR_PAIR(GAME_CPAIR_SKILL);
+	}
+
+	// thirds, without any floating point
+	int walls = 3*mipMap.getWalls(level, row, col), squares = mipMap.getSquares(level, row, col);
+	if (walls == 0) return DISPLAY_CHAR_EMPTY;
+	if (walls <= squares) return MINIMAP_CHAR_SPARSE;
+	if (walls <= 2*squares) return MINIMAP_CHAR_MEDIUM;
+	return DISPLAY_CHAR_WALL;
+}
+
+/*****************************************************************************************
+ ** Function: refreshMaze
+ ** Description: Gets the maze ready to go on the screen with the next commitFrame(). 
+ **				 With a pad, that means showing the part of it the camera is over, and 
+ **				 blanking whatever the pad doesn't cover (when the camera is past the edge
+ **				 of the maze).
+ ** Parameters: none.
+ ** Pre-Conditions: mazeWin has already been initialized.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Game::refreshMaze() {
+	// the minimap is drawn to mazeWin even with a pad
+	if (mazePad == nullptr || showMinimap) {
+		wnoutrefresh(mazeWin);
+		return;
+	}
+
+	int padRows, padCols;
+	getmaxyx(mazePad, padRows, padCols);
+
+	// top left pad row/col to show, and where on mazeWin it goes
+	int padRow = cameraRow + 1, padCol = cameraCol + 1;
+	int winRow = std::max(-padRow, 0), winCol = std::max(-padCol, 0);
+	padRow += winRow;
+	padCol += winCol;
+	int rows = std::min(mazeWinRows - winRow, padRows - padRow);
+	int cols = std::min(COLS - winCol, padCols - padCol);
+
+	if (rows < mazeWinRows || cols < COLS) {
+		touchwin(mazeWin);
+		wnoutrefresh(mazeWin);
+	}
+	if (rows > 0 && cols > 0) {
+		// something else (like an alert) might've been drawn over it since last time
+		touchline(mazePad, padRow, rows);
+		pnoutrefresh(mazePad, padRow, padCol, GAME_HUD_HEIGHT + winRow, winCol, 
+					 GAME_HUD_HEIGHT + winRow + rows - 1, winCol + cols - 1);
+	}
+}
+
+/*****************************************************************************************
+ ** Function: commitFrame
+ ** Description: Sends everything that's been drawn since the last frame to the terminal
+ **				 at once, so the HUD, maze, and alert never show up half updated. The 
+ **				 alert goes last so it's always on top.
+ ** Parameters: none.
+ ** Pre-Conditions: The windows that changed were already passed to wnoutrefresh().
+ ** Post-Conditions: The screen matches every window.
+ ****************************************************************************************/
+void Game::commitFrame() {
+	if (alertWin != nullptr) {
+		// the maze might've been put over it this frame
+		touchwin(alertWin);
+		wnoutrefresh(alertWin);
+	}
+
+	TermStats::startFrame();
+	doupdate();
+	TermStats::endFrame();
+}
+
 /*****************************************************************************************
  ** Function: takeTurn
  ** Description: Takes a single turn in the maze. Moves everybody and refreshes everything
@@ -593,16 +1398,25 @@ void Game::drawMazeBorder() {
 bool Game::takeTurn(int input) {
 	// move everybody and redraw stuff 
 	maze.takeTurn(input);
+	turn++;
+	if (!replaying) replay.addTurn(input);
+	TermStats::addTurn();
 
 	// win/lose condition
 	bool won;
 	if (maze.checkGameEnd(won)) {
 		// show ending screen
 		redrawHudLeft();
-		drawMaze();
-		wrefresh(hudWin);
-		wrefresh(mazeWin);
+		drawChanges();
+		wnoutrefresh(hudWin);
+		refreshMaze();
+
+		// a replay just stops at the end, so it can still be looked back through
+		if (replaying) return true;
 		
+		// anything typed before the game ended shouldn't answer the alert
+		flushinp();
+
 		// make alert
 		alertType = won ? ALERT_WON : ALERT_LOST;
 		initAlertWin();
@@ -849,7 +1663,7 @@ void Game::drawAlert() {
 	int row = 2*ALERT_ELEMENT_MARGIN + text.size();
 	for (int i = 0; i < buttons.size(); i++) drawAlertButton(buttons, i, row);
 
-	wrefresh(alertWin);
+	wnoutrefresh(alertWin);
 }
 
 /*****************************************************************************************
@@ -905,9 +1719,60 @@ void Game::closeAlert() {
 	alertWin = nullptr;
 
 	drawHud();
-	wrefresh(hudWin);
+	wnoutrefresh(hudWin);
 	drawMaze();
-	wrefresh(mazeWin);
+	refreshMaze();
+}
+
+/*****************************************************************************************
+ ** Function: setSquareSize
+ ** Description: Sets the zoom, and picks the version of stampSquareAt() made for it.
+ ** Parameters: size (int) - chars per side of a square (1, 3, or up to 
+ **					GAME_MAX_SQUARE_SIZE)
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Anything drawn before needs to be redrawn.
+ ****************************************************************************************/
+void Game::setSquareSize(int size) {
+	switch (size) {
+		case 1:
+			stampSquareSized = &Game::stampSquareAt<1>;
+			break;
+		case 5:
+			stampSquareSized = &Game::stampSquareAt<5>;
+			break;
+		default:
+			size = 3;
+			stampSquareSized = &Game::stampSquareAt<3>;
+			break;
+	}
+	squareSize = size;
+}
+
+/*****************************************************************************************
+ ** Function: cycleZoom
+ ** Description: Goes to the next zoom (3, then 5, then 1, then back to 3), centering the
+ **				 camera on the student again.
+ ** Parameters: none.
+ ** Pre-Conditions: mazeWin has already been initialized.
+ ** Post-Conditions: The maze still needs to be drawn (drawMaze()).
+ ****************************************************************************************/
+void Game::cycleZoom() {
+	if (squareSize == 1) setSquareSize(3);
+	else if (squareSize == 3) setSquareSize(5);
+	else setSquareSize(1);
+	initCamera();
+
+	// the pad is the size of the whole maze, so it has to be made again (if it still fits)
+	if (CmdArgs::getUsePad()) {
+		if (mazePad != nullptr) delwin(mazePad);
+		mazePad = nullptr;
+		initMazePad();
+
+		if (mazePad != nullptr) {
+			werase(mazeWin);
+			wnoutrefresh(mazeWin);
+		}
+	}
 }
 
 /*****************************************************************************************
@@ -927,7 +1792,7 @@ int Game::minCameraRow() const { return -mazeWinRows/2; }
  ** Post-Conditions: none.
  ****************************************************************************************/
 int Game::maxCameraRow() const {
-	return GAME_SQUARE_SIZE*maze.getMazeHeight() - mazeWinRows/2;
+	return squareSize*maze.getMazeHeight() - mazeWinRows/2;
 }
 
 /*****************************************************************************************
@@ -947,7 +1812,7 @@ int Game::minCameraCol() const { return -COLS/2; }
  ** Post-Conditions: none.
  ****************************************************************************************/
 int Game::maxCameraCol() const {
-	return GAME_SQUARE_SIZE*maze.getMazeWidth() - COLS/2;
+	return squareSize*maze.getMazeWidth() - COLS/2;
 }
 
 /*****************************************************************************************
@@ -961,20 +1826,20 @@ int Game::maxCameraCol() const {
  ****************************************************************************************/
 void Game::initCamera() {
 	// physical row/col of the student (center)
-	int stuRow = GAME_SQUARE_SIZE*maze.getStudent()->getRow() + GAME_SQUARE_SIZE/2;
-	int stuCol = GAME_SQUARE_SIZE*maze.getStudent()->getCol() + GAME_SQUARE_SIZE/2;
+	int stuRow = squareSize*maze.getStudent()->getRow() + squareSize/2;
+	int stuCol = squareSize*maze.getStudent()->getCol() + squareSize/2;
 
 	// center on the maze if the entire maze fits on the screen 
 	// otherwise, center on the player (at least as much as possible)
-	if (mazeWinRows > GAME_SQUARE_SIZE*maze.getMazeHeight()) 
-		cameraRow = (GAME_SQUARE_SIZE*maze.getMazeHeight() - mazeWinRows)/2;
+	if (mazeWinRows > squareSize*maze.getMazeHeight()) 
+		cameraRow = (squareSize*maze.getMazeHeight() - mazeWinRows)/2;
 	else {
 		cameraRow = std::min(stuRow - mazeWinRows/2, maxCameraRow());
 		cameraRow = std::max(minCameraRow(), cameraRow);
 	}
 
-	if (COLS > GAME_SQUARE_SIZE*maze.getMazeWidth()) 
-		cameraCol = (GAME_SQUARE_SIZE*maze.getMazeWidth() - COLS)/2;
+	if (COLS > squareSize*maze.getMazeWidth()) 
+		cameraCol = (squareSize*maze.getMazeWidth() - COLS)/2;
 	else {
 		cameraCol = std::min(stuCol - COLS/2, maxCameraCol());
 		cameraCol = std::max(minCameraCol(), cameraCol);
@@ -990,7 +1855,7 @@ void Game::initCamera() {
  ****************************************************************************************/
 void Game::moveCameraLeftRight(bool left) {
 	// the maze is too small to care (should already be centered on maze)
-	if (COLS > GAME_SQUARE_SIZE*maze.getMazeWidth()) return;
+	if (COLS > squareSize*maze.getMazeWidth()) return;
 	
 	
 	if (left) cameraCol = std::max(cameraCol - 1, minCameraCol());
@@ -1006,7 +1871,7 @@ void Game::moveCameraLeftRight(bool left) {
  ****************************************************************************************/
 void Game::moveCameraUpDown(bool up) {
 	// the maze is too small to care (should already be centered on maze)
-	if (mazeWinRows > GAME_SQUARE_SIZE*maze.getMazeHeight()) return;
+	if (mazeWinRows > squareSize*maze.getMazeHeight()) return;
 	
 	if (up) cameraRow = std::max(cameraRow - 1, minCameraRow());
 	else cameraRow = std::min(cameraRow + 1, maxCameraRow());
@@ -12,19 +12,41 @@
 #define __game_h__
 
 #include<string>
+#include<vector>
+#include<chrono>
 #include<ncurses.h>
 
 #include "panel.h"
 #include "maze.h"
 #include "mazeperson.h"
+#include "tilemipmap.h"
+#include "replay.h"
 
 class Game : public Panel {
 	protected: 
 		WINDOW *hudWin, *mazeWin, *alertWin;
+		// the whole maze plus its border (with --pad), shown on top of mazeWin (which 
+		// stays blank) so moving the camera only changes which part of it is shown
+		WINDOW* mazePad;
 		Maze maze; 
+		// the log of this game (which is saved with --record), or the one being watched
+		Replay replay;
+		bool replaying;
+		// turns taken so far
+		int turn;
+		// chars per side of a square (the zoom), and what draws a square at that size
+		int squareSize;
+		void (Game::*stampSquareSized)(int mazeRow, int mazeCol, bool inFog, 
+									   chtype* stamp);
+		// zoomed out copies of the maze for the minimap, kept up to date every turn
+		TileMipMap mipMap;
+		bool showMinimap;
 		int mazeWinRows;
 		// num cols are always the cols of the window (just use COLS) 
 
+		// what's in mazeWin (mazeWinRows by COLS), so it can be written whole rows at a time
+		std::vector<chtype> frame;
+
 		// top left corner relative to the top left corner of the maze (display coords)
 		// coords of something relative to the camera: actual row/col - camera row/col
 		int cameraRow, cameraCol;
@@ -36,6 +58,30 @@ class Game : public Panel {
 
 		bool askTutorial;
 
+		// real-time mode (--tick): how long a tick is, when the next one is due, and the 
+		// turn the user asked for during this one (a wait if they didn't)
+		int tickMs;
+		std::chrono::steady_clock::time_point nextTick;
+		int queuedTurn;
+
+		// AI mode: whether it plays by itself, how many turns it takes a tick (fast 
+		// forward), and whether it's running through to the end of the game
+		bool autoplay;
+		int turnsPerTick;
+		bool finishing;
+
+		int getInput(int delay);
+		Panel* loopRealTime();
+		void tick();
+		bool getTicking() const;
+		int getTickInterval() const;
+		bool isTurnInput(int chr);
+		void handleInputAutoplay(int chr);
+		void handleInputReplay(int chr);
+		bool getReplayOver() const;
+		void stepReplay();
+		void seekReplay(int target);
+
 		// return true if we're going to another panel 
 		bool handleInputMaze(int chr, Panel*& nextPanel);
 		bool handleInputAlert(int chr, Panel*& nextPanel);
@@ -44,21 +90,38 @@ class Game : public Panel {
 		void initHudWin();
 		void initMazeWin();
 		void initAlertWin();
+		void initMazePad();
 
 		virtual void draw() override;
 
 		void drawHud();
 		void drawHudLeft();
 		void redrawHudLeft();	// only need to redraw the left HUD since the right is completely static
+		void drawHudTurn();
 		void drawHudRight();
+		void drawHudAutoplay();
 		
 		void drawMaze();
-		void drawSquare(int mazeRow, int mazeCol);
-		void drawPerson(const MazePerson* person);
+		void drawChanges();
+		void updateChanges();
+		void drawSquare(int mazeRow, int mazeCol, bool inFog);
+		void flushSquare(int mazeRow, int mazeCol);
+		void stampSquare(int mazeRow, int mazeCol, bool inFog, chtype* stamp);
+		template<int SIZE> void stampSquareAt(int mazeRow, int mazeCol, bool inFog, 
+											  chtype* stamp);
 		void drawMazeBorder();
+		void drawPad();
+		void drawPadSquare(int mazeRow, int mazeCol);
+		void drawMinimap();
+		chtype getMinimapChar(int level, int row, int col);
+		void refreshMaze();
+		void commitFrame();
 
 		bool takeTurn(int input);
 
+		void setSquareSize(int size);
+		void cycleZoom();
+
 		void initCamera();
 		void moveCameraLeftRight(bool left);
 		void moveCameraUpDown(bool up);
@@ -80,10 +143,13 @@ class Game : public Panel {
 		
 		void redrawAlert(int newOption);
 		void closeAlert();
+
+		Game(const Replay& gameReplay, bool tutorial, bool replaying);
 	public:
 		Game(int mazeSize);
 		Game(int mazeWidth, int mazeHeight);
 		Game(int mazeWidth, int mazeHeight, bool askTutorial);
+		Game(const Replay& gameReplay);
 		virtual ~Game();
 
 		virtual void init() override;
@@ -15,11 +15,11 @@
 /*****************************************************************************************
  ** Function: move
  ** Description: Since the instructor doesn't move... it just returns no move.
- ** Parameters: none.
+ ** Parameters: rng (Rng&) - the maze's generator for people moving (unused)
  ** Pre-Conditions: none. 
  ** Post-Conditions: none.
  ****************************************************************************************/
-int Instructor::move() const { return MAZE_MOVE_NONE; }
+int Instructor::move(Rng& rng) const { return MAZE_MOVE_NONE; }
 
 /*****************************************************************************************
  ** Function: getDisplayChar
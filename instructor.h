@@ -15,7 +15,7 @@
 
 class Instructor : public MazePerson {
 	public:
-		virtual int move() const override;
+		virtual int move(Rng& rng) const override;
 		virtual int getDisplayChar() const override;
 };
 
@@ -11,7 +11,6 @@
 
 #include "consts.h"
 #include "intrepidstudent.h"
-#include "ta.h"
 
 /*****************************************************************************************
  ** Function: IntrepidStudent (constructor)
@@ -34,11 +33,11 @@ int IntrepidStudent::getNumSkills() const { return numSkills; }
 /*****************************************************************************************
  ** Function: move
  ** Description: Returns no move, since there was no input.
- ** Parameters: none.
+ ** Parameters: rng (Rng&) - the maze's generator for people moving (unused)
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-int IntrepidStudent::move() const { return MAZE_MOVE_NONE; }
+int IntrepidStudent::move(Rng& rng) const { return MAZE_MOVE_NONE; }
 
 /*****************************************************************************************
  ** Function: move
@@ -90,14 +89,15 @@ void IntrepidStudent::addSkill() { numSkills++; }
 
 /*****************************************************************************************
  ** Function: useSkill
- ** Description: Uses a skill to appease all of the TAs.
+ ** Description: Uses up a skill (to appease all of the TAs).
  ** Parameters: none.
  ** Pre-Conditions: none.
- ** Post-Conditions: All of the TAs are appeased and the counter resets.
+ ** Post-Conditions: Returns whether there was a skill to use. The maze is the one that 
+ **					 actually appeases the TAs.
  ****************************************************************************************/
-void IntrepidStudent::useSkill() {
-	if (numSkills == 0) return;
+bool IntrepidStudent::useSkill() {
+	if (numSkills == 0) return false;
 
 	numSkills--;
-	TA::setAppeased(true);
+	return true;
 }
\ No newline at end of file
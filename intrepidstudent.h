@@ -19,14 +19,14 @@ class IntrepidStudent : public MazePerson {
 	public:
 		IntrepidStudent();
 
-		virtual int move() const override;
+		virtual int move(Rng& rng) const override;
 		int move(int inputChar) const;
 		
 		virtual int getDisplayChar() const override;
 		
 		int getNumSkills() const;
 		void addSkill();
-		void useSkill();
+		bool useSkill();
 };
 
 #endif 
\ No newline at end of file
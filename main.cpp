@@ -6,16 +6,28 @@
  ** Input: Takes user inputs from the terminal. 
  ** Output: Outputs all of the game things to terminal.
  ****************************************************************************************/
-#include<random>
-#include<time.h>
 #include<ncurses.h>
 #include<string>
+#include<iostream>
 
+#include "cmdargs.h"
 #include "panel.h"
 #include "startpanel.h"
+#include "game.h"
+#include "replay.h"
+#include "termstats.h"
 
-int main() {
-	srand(time(nullptr));
+int main(int argc, char** argv) {
+	if (!CmdArgs::parse(argc, argv)) return 1;
+	if (CmdArgs::getShowStats()) TermStats::enable();
+
+	// a replay goes straight to the game, so it has to be read before curses starts
+	Replay replay;
+	const std::string& replayFile = CmdArgs::getReplayFile();
+	if (replayFile != "" && !replay.load(replayFile)) {
+		std::cerr << "couldn't read a replay from " << replayFile << std::endl;
+		return 1;
+	}
 
 	// curses init 
 	initscr();
@@ -27,7 +39,9 @@ int main() {
 	keypad(stdscr, true);
 	curs_set(0);
 
-	Panel* p = new StartPanel();
+	Panel* p = nullptr;
+	if (replayFile != "") p = new Game(replay);
+	else p = new StartPanel();
 
 	while (p != nullptr) {
 		p->init();
@@ -36,5 +50,7 @@ int main() {
 		p = temp;
 	}
 	endwin();
+
+	TermStats::print(std::cout);
 	return 0;
 }
\ No newline at end of file
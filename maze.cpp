@@ -8,52 +8,118 @@
  **			class. Some of them also do some other functions for changing it.
  ****************************************************************************************/
 #include<math.h>
+#include<algorithm>
 #include<vector>
-#include<random>
+#include<cstdint>
+#include<string>
+#include<utility>
 
 #include "consts.h"
 #include "maze.h"
-#include "mazelocation.h"
-#include "openspace.h"
-#include "wall.h"
+#include "mazeoptions.h"
+#include "tilegrid.h"
+#include "mazesearch.h"
+#include "cellpool.h"
+#include "rng.h"
 
 #include "mazeperson.h"
-#include "ai.h"
+#include "aistrategy.h"
 #include "intrepidstudent.h"
 #include "instructor.h"
-#include "ta.h"
-
-#include "optionspanel.h"
+#include "tagroup.h"
 
 /*****************************************************************************************
  ** Function: Maze (constructor)
  ** Description: Makes a new square Maze object.
  ** Parameters: size (int) - side length of the maze (square) 
+ **				seed (uint64_t) - the seed for everything random in the maze
+ **				options (const MazeOptions&) - the settings to make the maze with
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-Maze::Maze(int size) : Maze(size, size) {}
+Maze::Maze(int size, uint64_t seed, const MazeOptions& options) : 
+	Maze(size, size, seed, options) {}
 
 /*****************************************************************************************
  ** Function: Maze (constructor)
- ** Description: Makes a new Maze object.
+ ** Description: Makes a new Maze object. The same seed (and settings) always gives the 
+ **				 same maze, and the same game for the same inputs.
  ** Parameters: width (int) - width of the new Maze
  **				height (int) - height of the new Maze
+ **				seed (uint64_t) - the seed for everything random in the maze
+ **				options (const MazeOptions&) - the settings to make the maze with
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-Maze::Maze(int width, int height) {
-	TA::setAppeased(false);
-
-	// init map
-	mazeMap = std::vector<std::vector<MazeLocation*>>(height);
-	for (int i = 0; i < height; i++) mazeMap[i] = std::vector<MazeLocation*>(width);
-
-	OptionsPanel::loadFromFile(difficulty, useFogOfWar, useAI);
+Maze::Maze(int width, int height, uint64_t seed, const MazeOptions& options) : 
+	tiles(height, width), difficulty(options.difficulty), useAI(options.useAI), 
+	fogMode(options.fogMode), genMode(options.genMode), seed(seed), 
+	genRng(seed, MAZE_RNG_STREAM_GEN), taRng(seed, MAZE_RNG_STREAM_TA), 
+	aiRng(seed, MAZE_RNG_STREAM_AI), appeasedTurns(0), trackChanges(true), 
+	sight(MAZE_SIGHT_SIZE), lastSight(MAZE_SIGHT_SIZE), student(nullptr), 
+	instructor(nullptr), strategy(nullptr) {
+	if (useAI) {
+		strategy = AIStrategy::makeStrategy(options.aiStrategy);
+		strategy->setTiming(options.timeAI);
+	}
 	initMap();
 	skillCheck();
 }
 
+/*****************************************************************************************
+ ** Function: Maze (copy constructor)
+ ** Description: Makes a copy of another Maze, which plays on exactly the same as the 
+ **				 other one would (like for snapshots of a replay).
+ ** Parameters: other (const Maze&) - the Maze to copy
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Maze::Maze(const Maze& other) : 
+	tiles(other.tiles), tas(other.tas), difficulty(other.difficulty), 
+	useAI(other.useAI), fogMode(other.fogMode), genMode(other.genMode), 
+	seed(other.seed), genRng(other.genRng), taRng(other.taRng), aiRng(other.aiRng), 
+	appeasedTurns(other.appeasedTurns), changed(other.changed), 
+	trackChanges(other.trackChanges), visibleArea(other.visibleArea), sight(other.sight), 
+	lastSight(other.lastSight), student(nullptr), instructor(nullptr), strategy(nullptr) {
+	if (other.strategy != nullptr) strategy = other.strategy->clone();
+	copyPeople(other);
+}
+
+/*****************************************************************************************
+ ** Function: operator= (assignment operator overload)
+ ** Description: Makes this Maze a copy of another one.
+ ** Parameters: other (const Maze&) - the Maze to copy
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns this Maze.
+ ****************************************************************************************/
+Maze& Maze::operator=(const Maze& other) {
+	if (this == &other) return *this;
+
+	tiles = other.tiles;
+	tas = other.tas;
+	difficulty = other.difficulty;
+	useAI = other.useAI;
+	fogMode = other.fogMode;
+	genMode = other.genMode;
+	seed = other.seed;
+	genRng = other.genRng;
+	taRng = other.taRng;
+	aiRng = other.aiRng;
+	appeasedTurns = other.appeasedTurns;
+	changed = other.changed;
+	trackChanges = other.trackChanges;
+	visibleArea = other.visibleArea;
+	sight = other.sight;
+	lastSight = other.lastSight;
+
+	delete strategy;
+	strategy = other.strategy == nullptr ? nullptr : other.strategy->clone();
+
+	deletePeople();
+	copyPeople(other);
+	return *this;
+}
+
 /*****************************************************************************************
  ** Function: ~Maze (destructor)
  ** Description: Deletes the current Maze object.
@@ -62,129 +128,256 @@ Maze::Maze(int width, int height) {
  ** Post-Conditions: none.
  ****************************************************************************************/
 Maze::~Maze() {
-	// delete all spaces
-	for (int i = 0; i < mazeMap.size(); i++)
-		for (int j = 0; j < mazeMap[i].size(); j++)
-			if (mazeMap[i][j] != nullptr) delete mazeMap[i][j];
+	deletePeople();
+	delete strategy;
+}
+
+/*****************************************************************************************
+ ** Function: copyPeople
+ ** Description: Fills people with copies of the people in another maze (in the same 
+ **				 order), keeping the typed pointers to them too.
+ ** Parameters: other (const Maze&) - the maze to copy the people from
+ ** Pre-Conditions: people is empty.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Maze::copyPeople(const Maze& other) {
+	student = nullptr;
+	instructor = nullptr;
+
+	// it's only ever the student and the instructor
+	for (int i = 0; i < other.people.size(); i++) {
+		const MazePerson* p = other.people[i];
+		if (p == nullptr) people.push_back(nullptr);
+		else if (p == other.student) 
+			people.push_back(student = new IntrepidStudent(*other.student));
+		else people.push_back(instructor = new Instructor(*other.instructor));
+	}
+}
 
-	// delete all people 
+/*****************************************************************************************
+ ** Function: deletePeople
+ ** Description: Deletes all of the people in the maze.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: people is empty.
+ ****************************************************************************************/
+void Maze::deletePeople() {
 	for (int i = 0; i < people.size(); i++) 
 		if (people[i] != nullptr) delete people[i];
+	people.clear();
 }
 
 /*****************************************************************************************
  ** Function: initMap
- ** Description: Initializes the map for the maze (walls, people, and skills).
+ ** Description: Initializes the map for the maze (walls, people, and skills) using the 
+ **				 maze's generation mode.
  ** Parameters: none.
  ** Pre-Conditions: none.
- ** Post-Conditions: none.
+ ** Post-Conditions: The map is valid (see validMap()).
  ****************************************************************************************/
 void Maze::initMap() {
+	if (genMode == MAZE_GEN_CONSTRUCT) {
+		initMapConstructive();
+		return;
+	}
+
+	// nothing is reserved, so just keep trying until we get lucky
+	std::vector<bool> reserved(tiles.getRows()*tiles.getCols(), false);
+	bool placed;
 	do {
-		initWalls();
-		initPeople();
-		initSkills();
-	} while(!validMap());
+		tiles.clear();
+		initWalls(reserved);
+
+		CellPool open = getOpenCells();
+		placed = initPeople(open);
+		if (placed) {
+			initTAs(open);
+			initSkills(open, 0);
+		}
+	} while(!placed || !validMap());
 }
 
 /*****************************************************************************************
- ** Function: initWalls
- ** Description: Initializes the walls for the maze.
+ ** Function: initMapConstructive
+ ** Description: Initializes the map so that it's valid the first time. The student and 
+ **				 instructor go down first on an empty map, then paths from the student to
+ **				 the instructor and to MAZE_SKILLS_TO_PASS skills are reserved so that no
+ **				 walls can be put on them. Everything else is placed like normal after.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The map is valid (see validMap()).
+ ****************************************************************************************/
+void Maze::initMapConstructive() {
+	std::vector<bool> reserved(tiles.getRows()*tiles.getCols(), false);
+	tiles.clear();
+
+	// the map is empty, so there's always somewhere to put them
+	CellPool open = getOpenCells();
+	initPeople(open);
+
+	int stuRow = student->getRow(), stuCol = student->getCol();
+	reservePath(reserved, stuRow, stuCol, instructor->getRow(), instructor->getCol());
+
+	// the skills that make the map winnable (same rules as initSkills())
+	open.remove(tiles.getView().index(instructor->getRow(), instructor->getCol()));
+	for (int i = 0; i < MAZE_SKILLS_TO_PASS; i++) {
+		int index = open.get(genRng.nextInt(open.size()));
+		open.remove(index);
+
+		tiles.setSkill(index / tiles.getCols(), index % tiles.getCols(), true);
+		reservePath(reserved, stuRow, stuCol, index / tiles.getCols(), index % tiles.getCols());
+	}
+
+	initWalls(reserved);
+
+	open = getOpenCells();
+	initTAs(open);
+	initSkills(open, MAZE_SKILLS_TO_PASS);
+}
+
+/*****************************************************************************************
+ ** Function: getOpenCells
+ ** Description: Gets a pool of every square on the map that isn't a wall.
  ** Parameters: none.
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-void Maze::initWalls() {
-	for (int i = 0; i < mazeMap.size(); i++) {
-		for (int j = 0; j < mazeMap[0].size(); j++) {
-			if (mazeMap[i][j] != nullptr) delete mazeMap[i][j];
-			mazeMap[i][j] = new OpenSpace();
+CellPool Maze::getOpenCells() const {
+	TileView view = tiles.getView();
+	CellPool pool(view.getRows()*view.getCols());
+
+	for (int r = 0; r < view.getRows(); r++) 
+		for (int c = 0; c < view.getCols(); c++) 
+			if (view.isOccupiable(r, c)) pool.add(view.index(r, c));
+	return pool;
+}
+
+/*****************************************************************************************
+ ** Function: reservePath
+ ** Description: Reserves a random shortest path between two squares (it only ever steps 
+ **				 towards the end square) so that no walls can be put on it.
+ ** Parameters: reserved (vector<bool>&) - which squares are reserved, by tile index
+ **				row1 (int) - the row of the square to start from
+ **				col1 (int) - the column of the square to start from
+ **				row2 (int) - the row of the square to end at
+ **				col2 (int) - the column of the square to end at
+ ** Pre-Conditions: Both squares are in bounds.
+ ** Post-Conditions: Every square on the path (including both ends) is reserved.
+ ****************************************************************************************/
+void Maze::reservePath(std::vector<bool>& reserved, int row1, int col1, int row2, int col2) {
+	int rowStep = row2 > row1 ? 1 : -1, colStep = col2 > col1 ? 1 : -1;
+	int rowsLeft = std::abs(row2 - row1), colsLeft = std::abs(col2 - col1);
+
+	reserved[row1*tiles.getCols() + col1] = true;
+	while (rowsLeft + colsLeft > 0) {
+		// weighted by how far is left so the path doesn't hug one side
+		if (genRng.nextInt(rowsLeft + colsLeft) < rowsLeft) {
+			row1 += rowStep;
+			rowsLeft--;
+		}
+		else {
+			col1 += colStep;
+			colsLeft--;
 		}
+		reserved[row1*tiles.getCols() + col1] = true;
 	}
-	
-	int row, col;
+}
+
+/*****************************************************************************************
+ ** Function: initWalls
+ ** Description: Initializes the walls for the maze. Won't put them on reserved squares.
+ ** Parameters: reserved (const vector<bool>&) - which squares can't be walls, by tile
+ **					index
+ ** Pre-Conditions: The map has no walls yet.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Maze::initWalls(const std::vector<bool>& reserved) {
 	int numWalls = MAZE_MIN_WALLS;
-	numWalls += (mazeMap.size()*mazeMap[0].size() - MAZE_SCALE)*MAZE_WALL_PER_SCALE/MAZE_SCALE;
+	numWalls += (tiles.getRows()*tiles.getCols() - MAZE_SCALE)*MAZE_WALL_PER_SCALE/MAZE_SCALE;
 	numWalls *= 1 + difficulty*MAZE_DIFF_MULT_WALL;		// difficulty multiplier
 
-	for (int i = 0; i < numWalls; i++) {
-		do {
-			row = rand() % mazeMap.size();
-			col = rand() % mazeMap[0].size();
-		} while (!mazeMap[row][col]->isOccupiable());
+	CellPool free(reserved.size());
+	for (int i = 0; i < reserved.size(); i++) 
+		if (!reserved[i]) free.add(i);
 
-		delete mazeMap[row][col];
-		mazeMap[row][col] = new Wall();
+	// can't place more walls than there are free squares
+	numWalls = std::min(numWalls, free.size());
+	for (int i = 0; i < numWalls; i++) {
+		int index = free.get(genRng.nextInt(free.size()));
+		free.remove(index);
+		tiles.setWall(index / tiles.getCols(), index % tiles.getCols());
 	}
 }
 
 /*****************************************************************************************
  ** Function: initSkills
  ** Description: Initializes the skills for the maze. Doesn't put them on the instructor.
- ** Parameters: none.
- ** Pre-Conditions: none.
+ ** Parameters: open (const CellPool&) - every square that isn't a wall
+ **				numPlaced (int) - the number of skills already on the map
+ ** Pre-Conditions: The student and instructor have been placed.
  ** Post-Conditions: none.
  ****************************************************************************************/
-void Maze::initSkills() {
-	int row, col; 
+void Maze::initSkills(const CellPool& open, int numPlaced) {
 	int numSkills = MAZE_MIN_SKILLS;
-	numSkills += (mazeMap.size()*mazeMap[0].size() - MAZE_SCALE)*MAZE_SKILLS_PER_SCALE/MAZE_SCALE;
+	numSkills += (tiles.getRows()*tiles.getCols() - MAZE_SCALE)*MAZE_SKILLS_PER_SCALE/MAZE_SCALE;
 	numSkills *= 1 + difficulty*MAZE_DIFF_MULT_SKILLS;		// difficulty multiplier
+
+	// only squares that could still take a skill
+	TileView view = tiles.getView();
+	CellPool free = open;
+	free.remove(view.index(instructor->getRow(), instructor->getCol()));
+	for (int i = 0; i < open.size(); i++) {
+		int index = open.get(i);
+		if (view.hasSkill(index / view.getCols(), index % view.getCols())) free.remove(index);
+	}
 	
-	for (int i = 0; i < numSkills; i++) {
-		do {
-			row = rand() % mazeMap.size();
-			col = rand() % mazeMap[0].size();
-		} while (!mazeMap[row][col]->isOccupiable() || 
-				dynamic_cast<OpenSpace*>(mazeMap[row][col])->getHasSkill() || 
-				(row == people[1]->getRow() && col == people[1]->getCol()));
-		
-		dynamic_cast<OpenSpace*>(mazeMap[row][col])->setHasSkill(true);
+	for (int i = numPlaced; i < numSkills && free.size() > 0; i++) {
+		int index = free.get(genRng.nextInt(free.size()));
+		free.remove(index);
+		tiles.setSkill(index / view.getCols(), index % view.getCols(), true);
 	}
 }
 
 /*****************************************************************************************
  ** Function: initPeople
- ** Description: Initializes all of the people in the maze.
- ** Parameters: none.
+ ** Description: Initializes the student and the instructor in the maze.
+ ** Parameters: open (CellPool&) - every square that isn't a wall
  ** Pre-Conditions: none.
- ** Post-Conditions: The student isn't right next to an Instructor or TA.
+ ** Post-Conditions: The student isn't right next to the Instructor. Returns false if 
+ **					 there was nowhere to put one of them (everything is a wall).
  ****************************************************************************************/
-void Maze::initPeople() {
-	if (people.size() != 0) {
-		for (int i = 0; i < people.size(); i++) 
-			if (people[i] != nullptr) delete people[i];
-		people.clear();
-	}
-
-	MazePerson* p;
+bool Maze::initPeople(CellPool& open) {
+	deletePeople();
 
-	if (useAI) p = new AI();
-	else p = new IntrepidStudent();
-	placeRandomly(p, false, false);
+	// typed pointers are kept so turns don't need to cast anything
+	student = new IntrepidStudent();
+	bool placed = placeRandomly(student, open, false, false);
 	
-	p = new Instructor();
-	placeRandomly(p, true, false);
+	instructor = new Instructor();
+	if (!placeRandomly(instructor, open, true, false) || !placed) return false;
+	tiles.setInstructor(instructor->getRow(), instructor->getCol(), true);
 
-	initTAs();
+	updateVisibleArea();
+	return true;
 }
 
 /*****************************************************************************************
  ** Function: initTAs
  ** Description: Initializes all of the TAs in the maze.
- ** Parameters: none.
- ** Pre-Conditions: none.
+ ** Parameters: open (CellPool&) - every square that isn't a wall
+ ** Pre-Conditions: The student and instructor have been placed.
  ** Post-Conditions: No TA is next to the student.
  ****************************************************************************************/
-void Maze::initTAs() {
+void Maze::initTAs(CellPool& open) {
 	int numTAs = MAZE_MIN_TAS;
-	numTAs += (mazeMap.size()*mazeMap[0].size() - MAZE_SCALE)*MAZE_TA_PER_SCALE/MAZE_SCALE;
+	numTAs += (tiles.getRows()*tiles.getCols() - MAZE_SCALE)*MAZE_TA_PER_SCALE/MAZE_SCALE;
 	numTAs *= 1 + difficulty*MAZE_DIFF_MULT_TA;		// difficulty multiplier
 	
-	MazePerson* p;
+	tas.clear(tiles.getRows(), tiles.getCols());
 	for (int i = 0; i < numTAs; i++) {
-		p = new TA();
-		placeRandomly(p, true, true);
+		int index = pickRandomly(open, true, true);
+		if (index == -1) break;
+		tas.add(index / tiles.getCols(), index % tiles.getCols());
 	}
 }
 
@@ -193,83 +386,87 @@ void Maze::initTAs() {
  ** Description: Randomly places the given person inside the maze, checking for the 
  **				 student, instructor, or both based on the given inputs.
  ** Parameters: p (MazePerson*) - the person to place
+ **				open (CellPool&) - every square that isn't a wall
  **				checkPlayer (bool) - whether to check for being adjacent to the player 
  **				checkInstructor (bool) - whether to check for being in the same square as
  **					the instructor or not
  ** Pre-Conditions: none.
- ** Post-Conditions: The given person has been randomly placed into the grid.
+ ** Post-Conditions: The given person has been added to people, and randomly placed into
+ **					 the grid unless this returns false (there was nowhere to put them). 
+ **					 open has the same squares as before.
  ****************************************************************************************/
-void Maze::placeRandomly(MazePerson* p, bool checkPlayer, bool checkInstructor) {
-	int row, col;
-	do {
-		row = rand() % mazeMap.size();
-		col = rand() % mazeMap[0].size();
-	} while (!mazeMap[row][col]->isOccupiable() 
-			 || (checkPlayer && adjacentToPlayer(row, col))
-			 || (checkInstructor && row == people[1]->getRow() && row == people[1]->getCol()));
-	p->setLocation(row, col);
+bool Maze::placeRandomly(MazePerson* p, CellPool& open, bool checkPlayer, 
+						 bool checkInstructor) {
+	// it's added either way so deletePeople() cleans it up
 	people.push_back(p);
+	int index = pickRandomly(open, checkPlayer, checkInstructor);
+	if (index == -1) return false;
+
+	p->setLocation(index / tiles.getCols(), index % tiles.getCols());
+	return true;
 }
 
 /*****************************************************************************************
- ** Function: validMap
- ** Description: Checks whether the current map is valid.
- ** Parameters: none.
+ ** Function: pickRandomly
+ ** Description: Randomly picks a square inside the maze, checking for the student, 
+ **				 instructor, or both based on the given inputs. Squares that can't be 
+ **				 used are taken out of the pool while picking, so it never has to try 
+ **				 again.
+ ** Parameters: open (CellPool&) - every square that isn't a wall
+ **				checkPlayer (bool) - whether to check for being adjacent to the player 
+ **				checkInstructor (bool) - whether to check for being in the same square as
+ **					the instructor or not
  ** Pre-Conditions: none.
- ** Post-Conditions: none.
+ ** Post-Conditions: Returns the tile index of the square, or -1 if open is empty. open 
+ **					 has the same squares as before.
  ****************************************************************************************/
-bool Maze::validMap() const {
-	std::vector<int> rows, cols;
-	int numSkills = 0;
-	bool instructorReachable = false;
+int Maze::pickRandomly(CellPool& open, bool checkPlayer, bool checkInstructor) {
+	TileView view = tiles.getView();
+
+	// at most the player's square, its 4 neighbors, and the instructor's square
+	int excluded[6];
+	int numExcluded = 0;
+	if (checkPlayer) {
+		int r = student->getRow(), c = student->getCol();
+		int dr[] = {0, -1, 1, 0, 0}, dc[] = {0, 0, 0, -1, 1};
+		for (int i = 0; i < 5; i++) 
+			if (view.inBounds(r + dr[i], c + dc[i])) 
+				excluded[numExcluded++] = view.index(r + dr[i], c + dc[i]);
+	}
+	if (checkInstructor) 
+		excluded[numExcluded++] = view.index(instructor->getRow(), instructor->getCol());
+
+	// only take out the ones that are actually in the pool so we put back the right ones
+	int numRemoved = 0;
+	for (int i = 0; i < numExcluded; i++) {
+		if (open.contains(excluded[i])) {
+			open.remove(excluded[i]);
+			excluded[numRemoved++] = excluded[i];
+		}
+	}
+
+	// if everything was excluded, there's nowhere good, so just use any open square
+	int index = -1;
+	if (open.size() > 0) index = open.get(genRng.nextInt(open.size()));
+	else if (numRemoved > 0) index = excluded[genRng.nextInt(numRemoved)];
 
-	validMapHelper(rows, cols, numSkills, instructorReachable, 
-				   people[0]->getRow(), people[0]->getCol());
-	return instructorReachable && numSkills >= 3;
+	for (int i = 0; i < numRemoved; i++) open.add(excluded[i]);
+
+	return index;
 }
 
 /*****************************************************************************************
  ** Function: validMap
- ** Description: Checks whether the current map is valid.
- ** Parameters: rows (vector<int>&) - rows of checked cells (corresponds to cols)
- **				cols (vector<int>&) - columns of checked cells (corresponds to rows)
- **				numSkills (int&) - current number of skills found
- **				instructorReachable (bool&) - whether we've found the instructor yet
- **				row (int) - the current row to check
- **				col (int) - the current column to check
- ** Pre-Conditions: none.
- ** Post-Conditions: Gives how many skills were found and whether the instructor could be
- **					 reached or not. 
- ****************************************************************************************/
-void Maze::validMapHelper(std::vector<int>& rows, std::vector<int>& cols, int& numSkills, 
-					bool& instructorReachable, int row, int col) const {
-	// check that the student can do two things: reach the instructor and get 3 skills
-	// slow as fuck but don't think there's any other way to do this
-	
-	// is it a valid space to check 
-	if (row < 0 || row >= mazeMap.size() || col < 0 || col >= mazeMap[0].size() 
-		|| !mazeMap[row][col]->isOccupiable()) 
-		return;
-	for (int i = 0; i < rows.size(); i++) 
-		if (row == rows[i] && col == cols[i]) return;
-
-	// add to checked spaces 
-	rows.push_back(row);
-	cols.push_back(col);
-
-	// increment num skills if possible
-	if (((OpenSpace*)mazeMap[row][col])->getHasSkill()) numSkills++;
-
-	// set instructorReachable if possible
-	instructorReachable |= people[1]->getRow() == row && people[1]->getCol() == col;
-
-	if (instructorReachable && numSkills >= 3) return;
-	
-	// recurse with cardinal dirs
-	validMapHelper(rows, cols, numSkills, instructorReachable, row - 1, col);
-	validMapHelper(rows, cols, numSkills, instructorReachable, row + 1, col);
-	validMapHelper(rows, cols, numSkills, instructorReachable, row, col - 1);
-	validMapHelper(rows, cols, numSkills, instructorReachable, row, col + 1);
+ ** Description: Checks whether the current map is valid, meaning the student can reach 
+ **				 both the instructor and enough skills to pass.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Maze::validMap() const {
+	MazeSearch search;
+	return search.checkReachable(tiles.getView(), student->getRow(), student->getCol(), 
+								 instructor->getRow(), instructor->getCol(), MAZE_SKILLS_TO_PASS);
 }
 
 /*****************************************************************************************
@@ -280,7 +477,7 @@ void Maze::validMapHelper(std::vector<int>& rows, std::vector<int>& cols, int& n
  ** Post-Conditions: none.
  ****************************************************************************************/
 bool Maze::adjacentToPlayer(MazePerson* p) const {
-	return adjacent(p->getRow(), p->getCol(), people[0]->getRow(), people[0]->getCol());
+	return adjacent(p->getRow(), p->getCol(), student->getRow(), student->getCol());
 }
 
 /*****************************************************************************************
@@ -292,7 +489,7 @@ bool Maze::adjacentToPlayer(MazePerson* p) const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 bool Maze::adjacentToPlayer(int row, int col) const {
-	return adjacent(row, col, people[0]->getRow(), people[0]->getCol());
+	return adjacent(row, col, student->getRow(), student->getCol());
 }
 
 /*****************************************************************************************
@@ -311,18 +508,13 @@ bool Maze::adjacent(int row1, int col1, int row2, int col2) const {
 }
 
 /*****************************************************************************************
- ** Function: getLoc
- ** Description: Gets the MazeLocation at the given row and column.
- ** Parameters: row (int) - the row of the square to get
- **				col (int) - the col of the square to get 
+ ** Function: getTiles
+ ** Description: Gets a read-only view of every square in the maze.
+ ** Parameters: none.
  ** Pre-Conditions: none.
- ** Post-Conditions: none.
+ ** Post-Conditions: The view is only good for as long as the maze is.
  ****************************************************************************************/
-const MazeLocation* Maze::getLoc(int row, int col) const {
-	if (row < 0 || row >= mazeMap.size() || col < 0 || col >= mazeMap[row].size())
-		return nullptr;
-	return mazeMap[row][col];
-}
+TileView Maze::getTiles() const { return tiles.getView(); }
 
 /*****************************************************************************************
  ** Function: getPerson
@@ -333,7 +525,7 @@ const MazeLocation* Maze::getLoc(int row, int col) const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 const MazePerson* Maze::getPerson(int index) const {
-	if (index < 0 || index > people.size()) return nullptr;
+	if (index < 0 || index >= int(people.size())) return nullptr;
 	return people[index];
 }
 
@@ -345,7 +537,18 @@ const MazePerson* Maze::getPerson(int index) const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 const IntrepidStudent* Maze::getStudent() const {
-	return dynamic_cast<IntrepidStudent*>(people[0]);
+	return student;
+}
+
+/*****************************************************************************************
+ ** Function: getInstructor
+ ** Description: Gets the instructor.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const MazePerson* Maze::getInstructor() const {
+	return instructor;
 }
 
 /*****************************************************************************************
@@ -356,10 +559,37 @@ const IntrepidStudent* Maze::getStudent() const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 int Maze::getNumSkills() const {
-	if (people.size() < 1) return -1;
-	return dynamic_cast<IntrepidStudent*>(people[0])->getNumSkills();	
+	if (student == nullptr) return -1;
+	return student->getNumSkills();
 }
 
+/*****************************************************************************************
+ ** Function: getSeed
+ ** Description: Gets the seed the maze was made with.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+uint64_t Maze::getSeed() const { return seed; }
+
+/*****************************************************************************************
+ ** Function: getTAsAppeased
+ ** Description: Gets whether the TAs are appeased right now.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Maze::getTAsAppeased() const { return appeasedTurns > 0; }
+
+/*****************************************************************************************
+ ** Function: getTAStatus
+ ** Description: Gets the status string of the TAs in this maze.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const std::string Maze::getTAStatus() const { return TAGroup::getStatus(appeasedTurns); }
+
 /*****************************************************************************************
  ** Function: getUsingAI
  ** Description: Gets whether the current player is an AI or not.
@@ -369,6 +599,15 @@ int Maze::getNumSkills() const {
  ****************************************************************************************/
 bool Maze::getUsingAI() const { return useAI; }
 
+/*****************************************************************************************
+ ** Function: getStrategy
+ ** Description: Gets the AI that's playing, like for how long it's taken to decide.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns nullptr if the AI isn't playing.
+ ****************************************************************************************/
+const AIStrategy* Maze::getStrategy() const { return strategy; }
+
 /*****************************************************************************************
  ** Function: getUsingFog
  ** Description: Gets whether fog of war is currently active.
@@ -376,7 +615,7 @@ bool Maze::getUsingAI() const { return useAI; }
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-bool Maze::getUsingFog() const { return useFogOfWar; }
+bool Maze::getUsingFog() const { return fogMode != OPTION_FOG_OFF; }
 
 /*****************************************************************************************
  ** Function: getMazeHeight
@@ -385,7 +624,7 @@ bool Maze::getUsingFog() const { return useFogOfWar; }
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-int Maze::getMazeHeight() const { return mazeMap.size(); }
+int Maze::getMazeHeight() const { return tiles.getRows(); }
 
 /*****************************************************************************************
  ** Function: getMazeWidth
@@ -394,17 +633,27 @@ int Maze::getMazeHeight() const { return mazeMap.size(); }
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-int Maze::getMazeWidth() const { return mazeMap[0].size(); }
+int Maze::getMazeWidth() const { return tiles.getCols(); }
 
 /*****************************************************************************************
- ** Function: getMazeHeight
- ** Description: Gets the number of rows in the maze (its height).
+ ** Function: getNumPeople
+ ** Description: Gets the number of people in the maze (the student and instructor, TAs 
+ **				 are separate).
  ** Parameters: none.
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
 int Maze::getNumPeople() const { return people.size(); }
 
+/*****************************************************************************************
+ ** Function: getTAs
+ ** Description: Gets every TA in the maze.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const TAGroup& Maze::getTAs() const { return tas; }
+
 /*****************************************************************************************
  ** Function: checkGameEnd
  ** Description: Checks whether the maze shows tha the game has ended or not. 
@@ -416,23 +665,40 @@ int Maze::getNumPeople() const { return people.size(); }
  ****************************************************************************************/
 bool Maze::checkGameEnd(bool& won) const {
 	// instructor check 
-	if (adjacentToPlayer(people[1])) {
-		won = dynamic_cast<IntrepidStudent*>(people[0])->getNumSkills() >= 3;
+	if (adjacentToPlayer(instructor)) {
+		won = student->getNumSkills() >= MAZE_SKILLS_TO_PASS;
 		return true;
 	}
 
 	// TA check
-	if (TA::getAppeased()) return false;
-	for (int i = 2; i < people.size(); i++) {
-		if (adjacentToPlayer(people[i])) {
-			won = false;
-			return true;
-		}
+	if (appeasedTurns > 0) return false;
+	if (taAdjacentToPlayer()) {
+		won = false;
+		return true;
 	}
 
 	return false;
 }
 
+/*****************************************************************************************
+ ** Function: taAdjacentToPlayer
+ ** Description: Checks whether any TA is next to (or on) the player. Only looks at the 
+ **				 TA counts of those 5 squares, so it doesn't matter how many TAs there are.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool Maze::taAdjacentToPlayer() const {
+	int r = student->getRow(), c = student->getCol();
+	if (tas.getCountAt(r, c) > 0) return true;
+
+	if (r > 0 && tas.getCountAt(r - 1, c) > 0) return true;
+	if (r < tiles.getRows() - 1 && tas.getCountAt(r + 1, c) > 0) return true;
+	if (c > 0 && tas.getCountAt(r, c - 1) > 0) return true;
+	if (c < tiles.getCols() - 1 && tas.getCountAt(r, c + 1) > 0) return true;
+	return false;
+}
+
 /*****************************************************************************************
  ** Function: appeaseTAs
  ** Description: Appeases the TAs if possible.
@@ -441,9 +707,7 @@ bool Maze::checkGameEnd(bool& won) const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 void Maze::appeaseTAs() {
-	IntrepidStudent* student = dynamic_cast<IntrepidStudent*>(people[0]);
-
-	if (student->getNumSkills() > 0) student->useSkill();
+	if (student->useSkill()) appeasedTurns = TA_APPEASED_TURNS;
 }
 
 /*****************************************************************************************
@@ -454,19 +718,123 @@ void Maze::appeaseTAs() {
  ** Post-Conditions: none.
  ****************************************************************************************/
 void Maze::takeTurn(int input) {
-	TA::decAppeased();
+	changed.clear();
+	bool wasAppeased = appeasedTurns > 0;
+	int stuRow = student->getRow(), stuCol = student->getCol();
+
+	if (appeasedTurns > 0) appeasedTurns--;
 	
-	if (useAI) input = dynamic_cast<AI*>(people[0])->getChar(mazeMap, people);
+	if (strategy != nullptr) input = strategy->decide(*this, aiRng);
 	
-	// give input to player, check for skills
+	// give input to player, check for skills (a collected skill is under the student)
 	if (input == 'p') appeaseTAs();
-	movePerson(people[0], dynamic_cast<IntrepidStudent*>(people[0])->move(input));
+	movePerson(student, student->move(input));
 	skillCheck();
+	if (trackChanges) {
+		changed.push_back(tiles.getView().index(stuRow, stuCol));
+		changed.push_back(tiles.getView().index(student->getRow(), student->getCol()));
+	}
+
+	// the fog moves with the student
+	if (fogMode != OPTION_FOG_OFF && 
+		(stuRow != student->getRow() || stuCol != student->getCol())) {
+		MazeArea before = visibleArea;
+		updateVisibleArea();
+		if (trackChanges) addFogChanges(before);
+	}
+
+	// every TA looks different when they get appeased or stop being appeased
+	if (trackChanges && wasAppeased != (appeasedTurns > 0)) {
+		for (int i = 0; i < tas.size(); i++) 
+			changed.push_back(tiles.getView().index(tas.getRow(i), tas.getCol(i)));
+	}
 
-	// loop through the rest and make them move 
-	for (int i = 1; i < people.size(); i++) movePerson(people[i], people[i]->move());
+	// the instructor never moves, so it's just the TAs (their squares are cheap to 
+	// collect, so they're just thrown away when nothing is tracking them)
+	tas.move(tiles.getView(), taRng, changed);
+	if (!trackChanges) changed.clear();
 }
 
+/*****************************************************************************************
+ ** Function: setTrackChanges
+ ** Description: Sets whether the squares that change each turn are kept track of. Only
+ **				 something drawing the maze needs them, so headless runs turn it off.
+ ** Parameters: track (bool) - whether to keep track of changed squares
+ ** Pre-Conditions: none.
+ ** Post-Conditions: getChangedSquares is empty from the next turn on if track is false.
+ ****************************************************************************************/
+void Maze::setTrackChanges(bool track) { trackChanges = track; }
+
+/*****************************************************************************************
+ ** Function: updateVisibleArea
+ ** Description: Works out what the student can see from where they are now. Without fog
+ **				 that's the whole maze. With line of sight fog, sight is worked out again 
+ **				 too (if the student moved), and the old one is kept in lastSight.
+ ** Parameters: none.
+ ** Pre-Conditions: The student has been placed.
+ ** Post-Conditions: visibleArea is inside the maze.
+ ****************************************************************************************/
+void Maze::updateVisibleArea() {
+	if (fogMode == OPTION_FOG_OFF) {
+		visibleArea.top = visibleArea.left = 0;
+		visibleArea.bottom = tiles.getRows() - 1;
+		visibleArea.right = tiles.getCols() - 1;
+		return;
+	}
+
+	int stuRow = student->getRow(), stuCol = student->getCol();
+	int radius = MAZE_FOG_SIZE;
+	if (fogMode == OPTION_FOG_SIGHT) {
+		radius = MAZE_SIGHT_SIZE;
+		// the old sight is kept for addFogChanges, and its buffer is reused for the new 
+		// one (the one from two moves ago is no use to anyone)
+		std::swap(sight, lastSight);
+		sight.update(tiles.getView(), stuRow, stuCol);
+	}
+
+	visibleArea.top = std::max(stuRow - radius, 0);
+	visibleArea.left = std::max(stuCol - radius, 0);
+	visibleArea.bottom = std::min(stuRow + radius, tiles.getRows() - 1);
+	visibleArea.right = std::min(stuCol + radius, tiles.getCols() - 1);
+}
+
+/*****************************************************************************************
+ ** Function: addFogChanges
+ ** Description: Marks the squares that went into or came out of the fog as changed. Only
+ **				 squares in the old or new visible areas can have.
+ ** Parameters: before (const MazeArea&) - the visible area before
+ ** Pre-Conditions: visibleArea, sight and lastSight have already been updated.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Maze::addFogChanges(const MazeArea& before) {
+	TileView view = tiles.getView();
+
+	// everything in both areas
+	int top = std::min(before.top, visibleArea.top);
+	int bottom = std::max(before.bottom, visibleArea.bottom);
+	int left = std::min(before.left, visibleArea.left);
+	int right = std::max(before.right, visibleArea.right);
+	for (int r = top; r <= bottom; r++) {
+		for (int c = left; c <= right; c++) {
+			bool seenBefore = before.contains(r, c) && 
+				(fogMode != OPTION_FOG_SIGHT || lastSight.isVisible(r, c));
+			if (seenBefore == getInFog(r, c)) changed.push_back(view.index(r, c));
+		}
+	}
+}
+
+/*****************************************************************************************
+ ** Function: getChangedSquares
+ ** Description: Gets every square that might look different because of the last turn 
+ **				 (people moving, skills collected, fog moving, TAs being appeased), so the
+ **				 screen only has to redraw those. Squares can show up more than once.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns the tile index of each square. It's only good until the next
+ **					 turn.
+ ****************************************************************************************/
+const std::vector<int>& Maze::getChangedSquares() const { return changed; }
+
 /*****************************************************************************************
  ** Function: movePerson
  ** Description: Moves a single person. 
@@ -489,7 +857,7 @@ bool Maze::movePerson(MazePerson* p, int move) {
 			}
 			break;
 		case MAZE_MOVE_DOWN:
-			if (r < mazeMap.size() - 1) {
+			if (r < tiles.getRows() - 1) {
 				r++;
 				moved = true;
 			}
@@ -501,15 +869,14 @@ bool Maze::movePerson(MazePerson* p, int move) {
 			}
 			break;
 		case MAZE_MOVE_RIGHT:
-			if (c < mazeMap[0].size() - 1) {
+			if (c < tiles.getCols() - 1) {
 				c++;
 				moved = true;
 			}
 			break;
 	}
 	// gotta check if the space itself is ok (also can't have an instructor)
-	if (moved && mazeMap[r][c]->isOccupiable() 
-		&& (r != people[1]->getRow() || c != people[1]->getCol())) {
+	if (moved && tiles.isOccupiable(r, c) && !tiles.hasInstructor(r, c)) {
 		p->setLocation(r, c);
 		return true;
 	}
@@ -524,11 +891,9 @@ bool Maze::movePerson(MazePerson* p, int move) {
  ** Post-Conditions: none.
  ****************************************************************************************/
 void Maze::skillCheck() {
-	IntrepidStudent* stu = dynamic_cast<IntrepidStudent*>(people[0]);
-	OpenSpace* sp = dynamic_cast<OpenSpace*>(mazeMap[stu->getRow()][stu->getCol()]);
-	if (sp->getHasSkill()) {
-		stu->addSkill();
-		sp->setHasSkill(false);
+	if (tiles.hasSkill(student->getRow(), student->getCol())) {
+		student->addSkill();
+		tiles.setSkill(student->getRow(), student->getCol(), false);
 	}
 }
 
@@ -540,12 +905,7 @@ void Maze::skillCheck() {
  ** Post-Conditions: none.
  ****************************************************************************************/
 bool Maze::getInFog(int personIndex) const {
-	if (!useFogOfWar) return false;
-
-	int stuRow = people[0]->getRow(), stuCol = people[0]->getCol();
-	int row = people[personIndex]->getRow(), col = people[personIndex]->getCol();
-
-	return std::abs(stuRow - row) > MAZE_FOG_SIZE || std::abs(stuCol - col) > MAZE_FOG_SIZE;
+	return getInFog(people[personIndex]->getRow(), people[personIndex]->getCol());
 }
 
 /*****************************************************************************************
@@ -557,8 +917,17 @@ bool Maze::getInFog(int personIndex) const {
  ** Post-Conditions: none.
  ****************************************************************************************/
 bool Maze::getInFog(int row, int col) const {
-	if (!useFogOfWar) return false;
-
-	int stuRow = people[0]->getRow(), stuCol = people[0]->getCol();
-	return std::abs(stuRow - row) > MAZE_FOG_SIZE || std::abs(stuCol - col) > MAZE_FOG_SIZE;
+	if (fogMode == OPTION_FOG_OFF) return false;
+	if (!visibleArea.contains(row, col)) return true;
+	return fogMode == OPTION_FOG_SIGHT && !sight.isVisible(row, col);
 }
+
+/*****************************************************************************************
+ ** Function: getVisibleArea
+ ** Description: Gets the part of the maze the student can see (everything outside of it
+ **				 is in fog). It's the whole maze when fog isn't on.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns an area that's only good until the next turn.
+ ****************************************************************************************/
+const MazeArea& Maze::getVisibleArea() const { return visibleArea; }
@@ -12,60 +12,118 @@
 #define __maze_h__
 
 #include<vector>
+#include<cstdint>
+#include<string>
 
-#include "mazelocation.h"
+#include "mazeoptions.h"
+#include "mazearea.h"
+#include "tilegrid.h"
+#include "cellpool.h"
+#include "rng.h"
 #include "mazeperson.h"
 #include "intrepidstudent.h"
+#include "tagroup.h"
+#include "fieldofview.h"
+
+class AIStrategy;
+class Instructor;
 
 class Maze {
 	private:
-		std::vector<std::vector<MazeLocation*>> mazeMap;
+		TileGrid tiles;
+		// just the student and instructor, TAs are kept together in tas
 		std::vector<MazePerson*> people;
+		TAGroup tas;
 
 		int difficulty;
-		bool useAI, useFogOfWar;
+		bool useAI;
+		int fogMode;
+		int genMode;
+
+		// one generator per job so e.g. the AI thinking more can't change where TAs go
+		uint64_t seed;
+		Rng genRng, taRng, aiRng;
+
+		// turns left that the TAs are appeased for
+		int appeasedTurns;
+
+		// tile indices of every square that looks different since the last turn, only 
+		// kept track of when something draws them (not in headless runs)
+		std::vector<int> changed;
+		bool trackChanges;
+
+		// what the student can see (all of the maze without fog), updated every turn
+		MazeArea visibleArea;
+		// which squares in visibleArea aren't behind walls (only with line of sight fog)
+		FieldOfView sight;
+		// sight from before the student last moved, swapped with sight instead of copied
+		FieldOfView lastSight;
+
+		// these are also in people (which owns them)
+		IntrepidStudent* student;
+		Instructor* instructor;
+		// what picks the student's moves (owned here), only set when the AI plays
+		AIStrategy* strategy;
 
 		void initMap();
-		void initWalls();
-		void initSkills();
-		void initPeople();
-		void initTAs();
+		void initMapConstructive();
+		CellPool getOpenCells() const;
+		void reservePath(std::vector<bool>& reserved, int row1, int col1, int row2, int col2);
+		void initWalls(const std::vector<bool>& reserved);
+		void initSkills(const CellPool& open, int numPlaced);
+		bool initPeople(CellPool& open);
+		void initTAs(CellPool& open);
+		void copyPeople(const Maze& other);
+		void deletePeople();
 
 		bool validMap() const;
-		void validMapHelper(std::vector<int>& rows, std::vector<int>& cols, int& numSkills, 
-								  bool& instructorReachable, int row, int col) const;
 		bool adjacentToPlayer(MazePerson* p) const;
 		bool adjacentToPlayer(int row, int col) const;
+		bool taAdjacentToPlayer() const;
 		bool adjacent(int row1, int col1, int row2, int col2) const;
 
-		void placeRandomly(MazePerson* p, bool checkPlayer, bool checkInstructor);
+		bool placeRandomly(MazePerson* p, CellPool& open, bool checkPlayer, 
+						   bool checkInstructor);
+		int pickRandomly(CellPool& open, bool checkPlayer, bool checkInstructor);
 
 		void appeaseTAs();
 		void skillCheck();
+		void updateVisibleArea();
+		void addFogChanges(const MazeArea& before);
 		bool movePerson(MazePerson* p, int move);
 	public:
-		Maze(int size);
-		Maze(int width, int height);
+		Maze(int size, uint64_t seed, const MazeOptions& options);
+		Maze(int width, int height, uint64_t seed, const MazeOptions& options);
+		Maze(const Maze& other);
+		Maze& operator=(const Maze& other);
 		~Maze();
-		// no copy constructor or AOO needed (only one used at a time, always pass by ref)
 
-		const MazeLocation* getLoc(int row, int col) const;
+		TileView getTiles() const;
 		
 		const MazePerson* getPerson(int index) const;
 		const IntrepidStudent* getStudent() const;
+		const MazePerson* getInstructor() const;
 		int getNumPeople() const;
+		const TAGroup& getTAs() const;
 
 		int getNumSkills() const;
+		uint64_t getSeed() const;
+		bool getTAsAppeased() const;
+		const std::string getTAStatus() const;
 		bool getUsingAI() const;
+		const AIStrategy* getStrategy() const;
 		bool getUsingFog() const;
 
 		bool getInFog(int personIndex) const;
 		bool getInFog(int row, int col) const;
+		const MazeArea& getVisibleArea() const;
 
 		int getMazeHeight() const;
 		int getMazeWidth() const;
 
+		void setTrackChanges(bool track);
 		void takeTurn(int input);
+		const std::vector<int>& getChangedSquares() const;
 
 		bool checkGameEnd(bool& won) const;
 };
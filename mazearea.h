@@ -0,0 +1,23 @@
+/*****************************************************************************************
+ ** Program Filename: mazearea.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the MazeArea struct, a rectangle of squares in the maze 
+ **				 (like the part of it the student can see through the fog).
+ ** Input: none.
+ ** Output: none.
+ ****************************************************************************************/
+#ifndef __mazearea_h__
+#define __mazearea_h__
+
+struct MazeArea {
+	// every side is inclusive, and the default is empty
+	int top = 0, left = 0, bottom = -1, right = -1;
+
+	bool containsRow(int row) const { return row >= top && row <= bottom; }
+	bool contains(int row, int col) const { 
+		return containsRow(row) && col >= left && col <= right; 
+	}
+};
+
+#endif
@@ -0,0 +1,27 @@
+/*****************************************************************************************
+ ** Program Filename: mazeoptions.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the MazeOptions struct, which holds every setting a maze
+ **				 is made with. The game fills it in from the options file and the headless
+ **				 runner fills it in from the command line.
+ ** Input: none.
+ ** Output: none.
+ ****************************************************************************************/
+#ifndef __mazeoptions_h__
+#define __mazeoptions_h__
+
+#include "consts.h"
+
+struct MazeOptions {
+	int difficulty = OPTION_DIFF_DEFAULT;
+	int fogMode = OPTION_FOG_DEFAULT;
+	bool useAI = OPTION_AI_DEFAULT;
+	int aiStrategy = OPTION_STRATEGY_DEFAULT;
+	// whether the AI keeps track of how long its moves take (only the headless runner 
+	// shows that)
+	bool timeAI = false;
+	int genMode = MAZE_GEN_DEFAULT;
+};
+
+#endif
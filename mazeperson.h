@@ -11,11 +11,13 @@
 #ifndef __mazeperson_h__
 #define __mazeperson_h__
 
+#include "rng.h"
+
 class MazePerson {
 	protected: 
 		int row, col;
 	public:
-		virtual int move() const = 0;
+		virtual int move(Rng& rng) const = 0;
 		virtual int getDisplayChar() const = 0;
 
 		void setLocation(int row, int col);
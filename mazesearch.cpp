@@ -0,0 +1,121 @@
+/*****************************************************************************************
+ ** Program Filename: mazesearch.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the MazeSearch class.
+ ** Input: Depends on the function, but usually the tiles of the maze and where to start.
+ ** Output: Depends on the function, but it generally gives out what the search found.
+ ****************************************************************************************/
+#include<vector>
+#include<cstdint>
+
+#include "mazesearch.h"
+#include "tilegrid.h"
+
+/*****************************************************************************************
+ ** Function: MazeSearch (constructor)
+ ** Description: Makes a new MazeSearch with nothing searched yet.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+MazeSearch::MazeSearch() : skillsFound(0), targetFound(false) {}
+
+/*****************************************************************************************
+ ** Function: reset
+ ** Description: Clears the results and scratch space from the last search. The buffers
+ **				 keep their memory so searching again doesn't reallocate.
+ ** Parameters: numTiles (int) - the number of squares in the maze about to be searched
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Nothing is visited and the frontier is empty.
+ ****************************************************************************************/
+void MazeSearch::reset(int numTiles) {
+	skillsFound = 0;
+	targetFound = false;
+
+	frontier.clear();
+	frontier.reserve(numTiles);
+	visited.assign((numTiles + 63)/64, 0);
+}
+
+/*****************************************************************************************
+ ** Function: testAndSetVisited
+ ** Description: Marks the given square as visited.
+ ** Parameters: index (int) - the tile index of the square
+ ** Pre-Conditions: reset() was called with enough squares.
+ ** Post-Conditions: Returns whether the square was already visited before this call.
+ ****************************************************************************************/
+bool MazeSearch::testAndSetVisited(int index) {
+	uint64_t bit = uint64_t(1) << (index & 63);
+	uint64_t& word = visited[index >> 6];
+
+	if (word & bit) return true;
+	word |= bit;
+	return false;
+}
+
+/*****************************************************************************************
+ ** Function: checkReachable
+ ** Description: Checks whether the target square and enough skills can be reached by
+ **				 walking through open squares from the start square. Each square is looked
+ **				 at once at most, and it stops as soon as both are found.
+ ** Parameters: tiles (const TileView&) - the maze to search
+ **				startRow (int) - the row to start from
+ **				startCol (int) - the column to start from
+ **				targetRow (int) - the row of the square that needs to be reachable
+ **				targetCol (int) - the column of the square that needs to be reachable
+ **				skillsNeeded (int) - the number of skills that need to be reachable
+ ** Pre-Conditions: The start square is in bounds.
+ ** Post-Conditions: Returns true if both were found. Either way, getSkillsFound() and
+ **					 getTargetFound() give what was found before the search stopped.
+ ****************************************************************************************/
+bool MazeSearch::checkReachable(const TileView& tiles, int startRow, int startCol,
+								int targetRow, int targetCol, int skillsNeeded) {
+	int rows = tiles.getRows(), cols = tiles.getCols();
+	int target = tiles.index(targetRow, targetCol);
+	reset(rows*cols);
+
+	if (!tiles.isOccupiable(startRow, startCol)) return false;
+
+	int start = tiles.index(startRow, startCol);
+	testAndSetVisited(start);
+	frontier.push_back(start);
+
+	for (int head = 0; head < frontier.size(); head++) {
+		int curr = frontier[head];
+		int row = curr / cols, col = curr % cols;
+
+		if (tiles.hasSkill(row, col)) skillsFound++;
+		targetFound |= curr == target;
+		if (targetFound && skillsFound >= skillsNeeded) return true;
+
+		// queue up cardinal dirs (bounds checked by row/col so indices don't wrap)
+		if (row > 0 && tiles.isOccupiable(row - 1, col) && !testAndSetVisited(curr - cols))
+			frontier.push_back(curr - cols);
+		if (row < rows - 1 && tiles.isOccupiable(row + 1, col) && !testAndSetVisited(curr + cols))
+			frontier.push_back(curr + cols);
+		if (col > 0 && tiles.isOccupiable(row, col - 1) && !testAndSetVisited(curr - 1))
+			frontier.push_back(curr - 1);
+		if (col < cols - 1 && tiles.isOccupiable(row, col + 1) && !testAndSetVisited(curr + 1))
+			frontier.push_back(curr + 1);
+	}
+	return false;
+}
+
+/*****************************************************************************************
+ ** Function: getSkillsFound
+ ** Description: Gets the number of skills the last search could reach.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int MazeSearch::getSkillsFound() const { return skillsFound; }
+
+/*****************************************************************************************
+ ** Function: getTargetFound
+ ** Description: Gets whether the last search could reach its target square.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool MazeSearch::getTargetFound() const { return targetFound; }
@@ -0,0 +1,40 @@
+/*****************************************************************************************
+ ** Program Filename: mazesearch.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the MazeSearch class, which walks the open squares of a
+ **				 maze breadth first to find out what can be reached from a square.
+ ** Input: Depends on the function, but usually the tiles of the maze and where to start.
+ ** Output: Depends on the function, but it generally gives out what the search found.
+ ****************************************************************************************/
+#ifndef __mazesearch_h__
+#define __mazesearch_h__
+
+#include<vector>
+#include<cstdint>
+
+#include "tilegrid.h"
+
+class MazeSearch {
+	private:
+		// squares waiting to be expanded (as tile indices), used as a plain FIFO
+		std::vector<int> frontier;
+		// one bit per square, set once the square has been put in the frontier
+		std::vector<uint64_t> visited;
+
+		int skillsFound;
+		bool targetFound;
+
+		void reset(int numTiles);
+		bool testAndSetVisited(int index);
+	public:
+		MazeSearch();
+
+		bool checkReachable(const TileView& tiles, int startRow, int startCol,
+							int targetRow, int targetCol, int skillsNeeded);
+
+		int getSkillsFound() const;
+		bool getTargetFound() const;
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*****************************************************************************************
+ ** Program Filename: myopicai.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the MyopicAI class. 
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#include<cstdlib>
+
+#include "consts.h"
+#include "myopicai.h"
+#include "maze.h"
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: getChar
+ ** Description: Gets the cheapest move (ties are picked randomly). Squares a TA could 
+ **				 get to next turn cost more, skills cost less until it has enough to 
+ **				 pass, and getting next to the instructor is free once it does (and off
+ **				 limits until then). It uses a skill if a TA is about to catch it.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: The return value is a character that corresponds to a normal user 
+ **					 input for moving the character (WASD or space) or using a skill (P).
+ ****************************************************************************************/
+int MyopicAI::getChar(const Maze& maze, Rng& rng) {
+	TileView map = maze.getTiles();
+	const TAGroup& tas = maze.getTAs();
+	const IntrepidStudent* student = maze.getStudent();
+	int row = student->getRow(), col = student->getCol();
+	int instRow = maze.getInstructor()->getRow(), instCol = maze.getInstructor()->getCol();
+	bool hunted = !maze.getTAsAppeased();
+	bool ready = student->getNumSkills() >= MAZE_SKILLS_TO_PASS;
+
+	if (hunted && student->getNumSkills() > 0 && 
+		getTANear(map, tas, row, col, AI_STRIKE_DISTANCE))
+		return 'p';
+
+	const int moves[5] = {MAZE_MOVE_NONE, MAZE_MOVE_UP, MAZE_MOVE_DOWN, MAZE_MOVE_LEFT, 
+						  MAZE_MOVE_RIGHT};
+	const int rowSteps[5] = {0, -1, 1, 0, 0};
+	const int colSteps[5] = {0, 0, 0, -1, 1};
+
+	int best = MAZE_MOVE_NONE, bestCost = 0, numTies = 0;
+	for (int i = 0; i < 5; i++) {
+		int r = row + rowSteps[i], c = col + colSteps[i];
+		if (moves[i] != MAZE_MOVE_NONE && 
+			(!map.inBounds(r, c) || !map.isOccupiable(r, c) || map.hasInstructor(r, c)))
+			continue;
+
+		bool nextToInstructor = std::abs(r - instRow) + std::abs(c - instCol) == 1;
+		if (nextToInstructor && !ready) continue;
+
+		int cost = 0;
+		if (moves[i] == MAZE_MOVE_NONE) cost += AI_COST_WAIT;
+		if (hunted && getTANear(map, tas, r, c, AI_TA_REACH)) cost += AI_COST_TA_NEAR;
+		if (!ready && map.hasSkill(r, c)) cost += AI_COST_SKILL;
+		if (nextToInstructor) cost += AI_COST_PASS;
+
+		// each tie replaces the one picked so far with 1 in (ties so far) odds
+		if (numTies == 0 || cost < bestCost) {
+			best = moves[i];
+			bestCost = cost;
+			numTies = 1;
+		}
+		else if (cost == bestCost && rng.nextInt(++numTies) == 0) best = moves[i];
+	}
+	return getMoveChar(best);
+}
+
+/*****************************************************************************************
+ ** Function: clone
+ ** Description: Makes a copy of this AI, for copies of the maze it's playing in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The caller owns the copy.
+ ****************************************************************************************/
+AIStrategy* MyopicAI::clone() const { return new MyopicAI(*this); }
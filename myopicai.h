@@ -0,0 +1,24 @@
+/*****************************************************************************************
+ ** Program Filename: myopicai.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the MyopicAI class, the AI strategy that only looks at 
+ **				 the squares right around it. Every move gets a cost from what's nearby 
+ **				 (TAs, skills, the instructor) and it takes the cheapest one.
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#ifndef __myopicai_h__
+#define __myopicai_h__
+
+#include "aistrategy.h"
+#include "rng.h"
+
+class MyopicAI : public AIStrategy {
+	protected:
+		virtual int getChar(const Maze& maze, Rng& rng) override;
+	public:
+		virtual AIStrategy* clone() const override;
+};
+
+#endif
@@ -8,33 +8,58 @@
  **			the panel.
  ****************************************************************************************/
 #include<fstream>
+#include<string>
 #include<ncurses.h>
 
 #include "optionspanel.h"
+#include "mazeoptions.h"
 #include "consts.h"
 #include "ncursesutils.h"
 #include "startpanel.h"
+#include "aistrategy.h"
 
 /*****************************************************************************************
  ** Function: loadFromFile
  ** Description: Loads options from file into the output parameters.
  ** Parameters: diff (int&) - output parameter for maze difficulty
- **				fog (bool&) - output parameter for whether to use fog of war or not
+ **				fog (int&) - output parameter for the kind of fog of war (files from 
+ **					before there were kinds have 0 or 1, which is off or nearby)
  **				ai (bool&) - output parameter for whether to use the AI or not
+ **				strategy (int&) - output parameter for which AI to use (saved by name, 
+ **					and files from before there were strategies don't have one)
  ** Pre-Conditions: none.
  ** Post-Conditions: none.
  ****************************************************************************************/
-void OptionsPanel::loadFromFile(int& diff, bool& fog, bool& ai) {
+void OptionsPanel::loadFromFile(int& diff, int& fog, bool& ai, int& strategy) {
 	std::ifstream file;
 	file.open(OPTION_FILE_NAME);
 	if (!file.good()) {
 		diff = OPTION_DIFF_DEFAULT;
 		fog = OPTION_FOG_DEFAULT;
 		ai = OPTION_AI_DEFAULT;
+		strategy = OPTION_STRATEGY_DEFAULT;
 		return;
 	}
-	file >> diff >> fog >> ai;
+	std::string strategyName;
+	file >> diff >> fog >> ai >> strategyName;
 	file.close();
+
+	if (fog < OPTION_FOG_OFF || fog > OPTION_FOG_SIGHT) fog = OPTION_FOG_DEFAULT;
+	strategy = AIStrategy::findStrategy(strategyName);
+	if (strategy == -1) strategy = OPTION_STRATEGY_DEFAULT;
+}
+
+/*****************************************************************************************
+ ** Function: loadMazeOptions
+ ** Description: Loads options from file into the settings for a new maze.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Anything not saved in the file is left as the default.
+ ****************************************************************************************/
+MazeOptions OptionsPanel::loadMazeOptions() {
+	MazeOptions options;
+	loadFromFile(options.difficulty, options.fogMode, options.useAI, options.aiStrategy);
+	return options;
 }
 
 /*****************************************************************************************
@@ -49,7 +74,8 @@ void OptionsPanel::saveToFile() {
 	file.open(OPTION_FILE_NAME, std::ios::trunc);
 	if (!file.good()) return;
 	
-	file << difficulty << ' ' << fogOfWar << ' ' << useAI;
+	file << difficulty << ' ' << fogMode << ' ' << useAI << ' ' 
+		 << AIStrategy::getName(aiStrategy);
 	
 	file.close();
 }
@@ -80,7 +106,7 @@ OptionsPanel::~OptionsPanel() {}
  ** Post-Conditions: none.
  ****************************************************************************************/
 void OptionsPanel::init() {
-	loadFromFile(difficulty, fogOfWar, useAI);
+	loadFromFile(difficulty, fogMode, useAI, aiStrategy);
 
 	resizeHandler();	// screen size check, also draw the screen 
 }
@@ -102,10 +128,10 @@ Panel* OptionsPanel::loop() {
 				// quit
 				return nullptr;
 			case 'w': case KEY_UP:
-				redrawButton((currOption + 3) % 4);
+				redrawButton((currOption + OPTION_NUM_BUTTONS - 1) % OPTION_NUM_BUTTONS);
 				break;
 			case 's': case KEY_DOWN:
-				redrawButton((currOption + 1) % 4);
+				redrawButton((currOption + 1) % OPTION_NUM_BUTTONS);
 				break;
 			case 'a': case KEY_LEFT:
 				handleLeftRightInput(true);
@@ -128,10 +154,10 @@ Panel* OptionsPanel::loop() {
  ** Post-Conditions: none.
  ****************************************************************************************/
 int OptionsPanel::getSpace() {
-	// 5 spaces total (between difficulty, fog, ai, and back)
+	// 6 spaces total (between difficulty, fog, ai, strategy, and back)
 	// fog and ai take up 3 lines each
 	// there are two spaces between options and back button
-	return (LINES - 8)/6;
+	return (LINES - 10)/7;
 }
 
 /*****************************************************************************************
@@ -151,6 +177,9 @@ void OptionsPanel::draw() {
 	drawDescription(OPTION_BUTTON_AI);
 	drawButton(OPTION_BUTTON_AI);
 
+	drawDescription(OPTION_BUTTON_STRATEGY);
+	drawButton(OPTION_BUTTON_STRATEGY);
+
 	// drawDescription(OPTION_BUTTON_BACK);
 	drawButton(OPTION_BUTTON_BACK);
 }
@@ -171,12 +200,16 @@ void OptionsPanel::drawDescription(int button) {
 			break;
 		case OPTION_BUTTON_FOG:
 			mvaddstr(2*getSpace()+2, OPTION_LEFT_MARGIN, OPTION_FOG_DESC);
-			Util::drawBox(2*getSpace()+1, OPTION_LEFT_MARGIN + sizeof(OPTION_FOG_DESC), 3, 3);
+			addch(ACS_LARROW);
 			break;
 		case OPTION_BUTTON_AI:
 			mvaddstr(3*getSpace()+5, OPTION_LEFT_MARGIN, OPTION_AI_DESC);
 			Util::drawBox(3*getSpace()+4, OPTION_LEFT_MARGIN + sizeof(OPTION_AI_DESC), 3, 3);
 			break;
+		case OPTION_BUTTON_STRATEGY:
+			mvaddstr(4*getSpace()+8, OPTION_LEFT_MARGIN, OPTION_STRATEGY_DESC);
+			addch(ACS_LARROW);
+			break;
 	}
 }
 
@@ -212,15 +245,37 @@ void OptionsPanel::drawButton(int button) {
 			addch(ACS_RARROW);
 			break;
 		case OPTION_BUTTON_FOG:
-			currChar = (fogOfWar ? OPTION_CHECK_ON : OPTION_CHECK_OFF) | attr;
-			mvaddch(2*getSpace()+2, OPTION_LEFT_MARGIN+sizeof(OPTION_FOG_DESC)+1, currChar);
+			// same as difficulty
+			move(2*getSpace()+2, OPTION_LEFT_MARGIN + sizeof(OPTION_FOG_DESC));
+			clrtoeol();
+			move(2*getSpace()+2, OPTION_LEFT_MARGIN + sizeof(OPTION_FOG_DESC));
+			switch(fogMode) {
+				case OPTION_FOG_OFF:
+					Util::drawString(OPTION_FOG_OFF_DESC, attr);
+					break;
+				case OPTION_FOG_SQUARE:
+					Util::drawString(OPTION_FOG_SQUARE_DESC, attr);
+					break;
+				case OPTION_FOG_SIGHT:
+					Util::drawString(OPTION_FOG_SIGHT_DESC, attr);
+					break;
+			}
+			addch(ACS_RARROW);
 			break;
 		case OPTION_BUTTON_AI:
 			currChar = (useAI ? OPTION_CHECK_ON : OPTION_CHECK_OFF) | attr;
 			mvaddch(3*getSpace()+5, OPTION_LEFT_MARGIN+sizeof(OPTION_AI_DESC)+1, currChar);
 			break;
+		case OPTION_BUTTON_STRATEGY:
+			// same as difficulty, but the names come from the strategies themselves
+			move(4*getSpace()+8, OPTION_LEFT_MARGIN + sizeof(OPTION_STRATEGY_DESC));
+			clrtoeol();
+			move(4*getSpace()+8, OPTION_LEFT_MARGIN + sizeof(OPTION_STRATEGY_DESC));
+			Util::drawString(AIStrategy::getTitle(aiStrategy), attr);
+			addch(ACS_RARROW);
+			break;
 		case OPTION_BUTTON_BACK:
-			Util::drawCentered(5*getSpace() + 7, OPTION_BACK_DESC, attr);
+			Util::drawCentered(6*getSpace() + 9, OPTION_BACK_DESC, attr);
 			break;
 	}
 }
@@ -248,11 +303,20 @@ void OptionsPanel::redrawButton(int newOption) {
  ** Post-Conditions: none.
  ****************************************************************************************/
 void OptionsPanel::handleLeftRightInput(bool left) {
-	// only matters for difficulty settings
-	if (currOption != OPTION_BUTTON_DIFF) return;
-	
-	if (left && difficulty != OPTION_DIFF_EASY) difficulty--;
-	else if (!left && difficulty != OPTION_DIFF_HARD) difficulty++;
+	// only matters for difficulty, fog, and strategy settings
+	if (currOption == OPTION_BUTTON_DIFF) {
+		if (left && difficulty != OPTION_DIFF_EASY) difficulty--;
+		else if (!left && difficulty != OPTION_DIFF_HARD) difficulty++;
+	}
+	else if (currOption == OPTION_BUTTON_FOG) {
+		if (left && fogMode != OPTION_FOG_OFF) fogMode--;
+		else if (!left && fogMode != OPTION_FOG_SIGHT) fogMode++;
+	}
+	else if (currOption == OPTION_BUTTON_STRATEGY) {
+		if (left && aiStrategy != 0) aiStrategy--;
+		else if (!left && aiStrategy != AI_NUM_STRATEGIES - 1) aiStrategy++;
+	}
+	else return;
 
 	saveToFile();
 	redrawButton(currOption);
@@ -276,13 +340,19 @@ bool OptionsPanel::handleEnterInput(Panel*& nextPanel) {
 		case OPTION_BUTTON_DIFF: 
 			return false;
 		case OPTION_BUTTON_FOG:
-			fogOfWar = !fogOfWar;
+			// goes through every kind of fog
+			fogMode = fogMode == OPTION_FOG_SIGHT ? OPTION_FOG_OFF : fogMode + 1;
 			saveToFile();
 			break;
 		case OPTION_BUTTON_AI:
 			useAI = !useAI;
 			saveToFile();
 			break;
+		case OPTION_BUTTON_STRATEGY:
+			// goes through every strategy, like fog
+			aiStrategy = (aiStrategy + 1) % AI_NUM_STRATEGIES;
+			saveToFile();
+			break;
 	}
 
 	redrawButton(currOption);
@@ -12,12 +12,14 @@
 #define __optionspanel_h__
 
 #include "panel.h"
+#include "mazeoptions.h"
 
 class OptionsPanel : public Panel {
 	private: 
 		int currOption;
-		int difficulty;
-		bool fogOfWar, useAI;
+		int difficulty, fogMode;
+		bool useAI;
+		int aiStrategy;
 
 		virtual void draw() override;
 
@@ -32,7 +34,8 @@ class OptionsPanel : public Panel {
 
 		void saveToFile();
 	public:
-		static void loadFromFile(int& diff, bool& fog, bool& ai);
+		static void loadFromFile(int& diff, int& fog, bool& ai, int& strategy);
+		static MazeOptions loadMazeOptions();
 
 		OptionsPanel();
 		virtual ~OptionsPanel();
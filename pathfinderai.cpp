@@ -0,0 +1,201 @@
+/*****************************************************************************************
+ ** Program Filename: pathfinderai.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the PathfinderAI class. 
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#include<cstdlib>
+
+#include "consts.h"
+#include "pathfinderai.h"
+#include "maze.h"
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: getChar
+ ** Description: Gets the move the AI wants to take. It uses a skill if a TA is about to 
+ **				 catch it, and otherwise heads for a skill (the nearest one) until it has 
+ **				 enough to pass, then for the instructor. The way to a skill comes from 
+ **				 one search out from the AI, which never steps where a TA could catch it 
+ **				 next turn and never gets next to the instructor too early. The way to 
+ **				 the instructor is downhill on a field built from the instructor, and 
+ **				 only needs that search if every step down is somewhere a TA could 
+ **				 catch it.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: The return value is a character that corresponds to a normal user 
+ **					 input for moving the character (WASD or space) or using a skill (P).
+ ****************************************************************************************/
+int PathfinderAI::getChar(const Maze& maze, Rng& rng) {
+	TileView map = maze.getTiles();
+	const IntrepidStudent* student = maze.getStudent();
+	int row = student->getRow(), col = student->getCol();
+	bool hunted = !maze.getTAsAppeased();
+
+	if (hunted && student->getNumSkills() > 0 && 
+		getTANear(map, maze.getTAs(), row, col, AI_STRIKE_DISTANCE))
+		return 'p';
+
+	bool ready = student->getNumSkills() >= MAZE_SKILLS_TO_PASS;
+	if (ready) {
+		int move = getHomeMove(maze, hunted);
+		if (move != MAZE_MOVE_NONE) return getMoveChar(move);
+	}
+
+	int target = ready ? search(maze, hunted, true) : findSkill(maze, hunted);
+	if (target == -1) return getSafeChar(map, row, col, rng);
+	return getMoveChar(field.getFirstMove(target));
+}
+
+/*****************************************************************************************
+ ** Function: findSkill
+ ** Description: Finds the skill the AI should go for next, which is the nearest one.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				hunted (bool) - whether the TAs are after the AI (not appeased)
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: Returns the skill's tile index, or -1 if it can't get to any. The 
+ **					 distance field is from the AI either way.
+ ****************************************************************************************/
+int PathfinderAI::findSkill(const Maze& maze, bool hunted) {
+	return search(maze, hunted, false);
+}
+
+/*****************************************************************************************
+ ** Function: checkSkill
+ ** Description: Checks a square the search for a skill got to. The search gets to them 
+ **				 nearest first, so the first one with a skill is the nearest skill.
+ ** Parameters: map (const TileView&) - the map of the maze
+ **				row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: field has this square's distance from the AI.
+ ** Post-Conditions: Returns true if the search should stop at this square.
+ ****************************************************************************************/
+bool PathfinderAI::checkSkill(const TileView& map, int row, int col) {
+	return map.hasSkill(row, col);
+}
+
+/*****************************************************************************************
+ ** Function: search
+ ** Description: Builds the distance field out from the AI, without stepping anywhere a 
+ **				 TA could catch it next turn or getting next to the instructor too early.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				hunted (bool) - whether the TAs are after the AI (not appeased)
+ **				ready (bool) - whether the AI has enough skills to pass, so it stops at the
+ **					nearest square closer to the instructor than the AI is, instead of 
+ **					wherever checkSkill() says
+ ** Pre-Conditions: The AI is the student in maze. If ready, the field from the 
+ **					instructor is built.
+ ** Post-Conditions: Returns the tile index of the square it stopped at, or -1 if it 
+ **					 didn't stop.
+ ****************************************************************************************/
+int PathfinderAI::search(const Maze& maze, bool hunted, bool ready) {
+	TileView map = maze.getTiles();
+	const TAGroup& tas = maze.getTAs();
+	int instRow = maze.getInstructor()->getRow(), instCol = maze.getInstructor()->getCol();
+	auto nextToInstructor = [&](int r, int c) {
+		return std::abs(r - instRow) + std::abs(c - instCol) == 1;
+	};
+	int row = maze.getStudent()->getRow(), col = maze.getStudent()->getCol();
+	// once past the TAs, the walk down the field from the instructor takes over
+	int here = ready ? homeField.getDistance(map.index(row, col)) : -1;
+
+	return field.search(map, row, col, 
+		[&](int r, int c, int distance) {
+			if (!ready && nextToInstructor(r, c)) return true;
+			// further away, the TAs will have moved by the time the AI gets there
+			return hunted && distance == 1 && getTANear(map, tas, r, c, AI_TA_REACH);
+		}, 
+		[&](int r, int c) {
+			if (!ready) return checkSkill(map, r, c);
+			int distance = homeField.getDistance(map.index(r, c));
+			return distance >= 0 && distance < here;
+		});
+}
+
+/*****************************************************************************************
+ ** Function: buildHomeField
+ ** Description: Builds the field from the instructor, if it hasn't been already.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void PathfinderAI::buildHomeField(const Maze& maze) {
+	TileView map = maze.getTiles();
+	int instRow = maze.getInstructor()->getRow(), instCol = maze.getInstructor()->getCol();
+	if (homeField.getStart() == map.index(instRow, instCol)) return;
+
+	homeField.search(map, instRow, instCol, 
+					 [](int, int, int) { return false; }, 
+					 [](int, int) { return false; });
+}
+
+/*****************************************************************************************
+ ** Function: getHomeMove
+ ** Description: Gets a move that takes the AI one step closer to the instructor without 
+ **				 going anywhere a TA could catch it next turn.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				hunted (bool) - whether the TAs are after the AI (not appeased)
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: Returns MAZE_MOVE_NONE if there's no safe step closer, or if the AI 
+ **					 can't get to the instructor at all.
+ ****************************************************************************************/
+int PathfinderAI::getHomeMove(const Maze& maze, bool hunted) {
+	buildHomeField(maze);
+
+	TileView map = maze.getTiles();
+	int row = maze.getStudent()->getRow(), col = maze.getStudent()->getCol();
+	int here = homeField.getDistance(map.index(row, col));
+	if (here <= 1) return MAZE_MOVE_NONE;
+
+	const int moves[4] = {MAZE_MOVE_UP, MAZE_MOVE_DOWN, MAZE_MOVE_LEFT, MAZE_MOVE_RIGHT};
+	const int rowSteps[4] = {-1, 1, 0, 0};
+	const int colSteps[4] = {0, 0, -1, 1};
+	for (int i = 0; i < 4; i++) {
+		int r = row + rowSteps[i], c = col + colSteps[i];
+		if (!map.inBounds(r, c) || homeField.getDistance(map.index(r, c)) != here - 1) 
+			continue;
+		if (!hunted || !getTANear(map, maze.getTAs(), r, c, AI_TA_REACH)) return moves[i];
+	}
+	return MAZE_MOVE_NONE;
+}
+
+/*****************************************************************************************
+ ** Function: getSafeChar
+ ** Description: Picks a random move out of the ones the last search found safe, for when
+ **				 there's nowhere to head for.
+ ** Parameters: map (const TileView&) - the map of the maze
+ **				row (int) - the row the AI is on
+ **				col (int) - the column the AI is on
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The last search started from where the AI is now.
+ ** Post-Conditions: Returns a space (waiting) if no move is safe.
+ ****************************************************************************************/
+int PathfinderAI::getSafeChar(const TileView& map, int row, int col, Rng& rng) const {
+	int moves[4];
+	int numMoves = 0;
+	if (row > 0 && field.getDistance(map.index(row - 1, col)) == 1) 
+		moves[numMoves++] = MAZE_MOVE_UP;
+	if (row < map.getRows() - 1 && field.getDistance(map.index(row + 1, col)) == 1) 
+		moves[numMoves++] = MAZE_MOVE_DOWN;
+	if (col > 0 && field.getDistance(map.index(row, col - 1)) == 1) 
+		moves[numMoves++] = MAZE_MOVE_LEFT;
+	if (col < map.getCols() - 1 && field.getDistance(map.index(row, col + 1)) == 1) 
+		moves[numMoves++] = MAZE_MOVE_RIGHT;
+
+	if (numMoves == 0) return ' ';
+	return getMoveChar(moves[rng.nextInt(numMoves)]);
+}
+
+/*****************************************************************************************
+ ** Function: clone
+ ** Description: Makes a copy of this AI, for copies of the maze it's playing in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The caller owns the copy.
+ ****************************************************************************************/
+AIStrategy* PathfinderAI::clone() const { return new PathfinderAI(*this); }
@@ -0,0 +1,40 @@
+/*****************************************************************************************
+ ** Program Filename: pathfinderai.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the PathfinderAI class, the AI strategy that heads for 
+ **				 the nearest skill until it has enough to pass, then for the instructor, 
+ **				 all without stepping anywhere a TA could catch it.
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#ifndef __pathfinderai_h__
+#define __pathfinderai_h__
+
+#include "aistrategy.h"
+#include "tilegrid.h"
+#include "distancefield.h"
+#include "rng.h"
+
+class PathfinderAI : public AIStrategy {
+	protected:
+		// how far every square is from the AI, worked out again every turn
+		DistanceField field;
+		// how far every square is from the instructor, which never moves (and neither do 
+		// the walls), so it's only worked out once
+		DistanceField homeField;
+
+		virtual int getChar(const Maze& maze, Rng& rng) override;
+		virtual int findSkill(const Maze& maze, bool hunted);
+		virtual bool checkSkill(const TileView& map, int row, int col);
+
+		int search(const Maze& maze, bool hunted, bool ready);
+		void buildHomeField(const Maze& maze);
+		int getHomeMove(const Maze& maze, bool hunted);
+		int getSafeChar(const TileView& map, int row, int col, Rng& rng) const;
+	public:
+		virtual AIStrategy* clone() const override;
+};
+
+
+#endif 
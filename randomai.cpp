@@ -0,0 +1,66 @@
+/*****************************************************************************************
+ ** Program Filename: randomai.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the RandomAI class. 
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#include "consts.h"
+#include "randomai.h"
+#include "maze.h"
+#include "tilegrid.h"
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: getChar
+ ** Description: Gets a random move that the AI is able to take.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: The return value is a character that corresponds to a normal user 
+ **					 input for moving the character (WASD or space) or using a skill (P).
+ ****************************************************************************************/
+int RandomAI::getChar(const Maze& maze, Rng& rng) {
+	TileView map = maze.getTiles();
+	int row = maze.getStudent()->getRow(), col = maze.getStudent()->getCol();
+	int numSkills = maze.getStudent()->getNumSkills();
+
+	int choice;
+	do {
+		choice = rng.nextInt(5);
+		switch(choice) {
+			// go up
+			case 0:
+				if (row != 0 && map.isOccupiable(row-1, col)) return 'w';
+				break;
+			// go left
+			case 1:
+				if (col != 0 && map.isOccupiable(row, col-1)) return 'a';
+				break;
+			// go down 
+			case 2:
+				if (row != map.getRows()-1 && map.isOccupiable(row+1, col)) return 's';
+				break;
+			// go right
+			case 3:
+				if (col != map.getCols()-1 && map.isOccupiable(row, col+1)) return 'd';
+				break;
+			// demo skill
+			case 4:
+				if (numSkills != 0) return 'p';
+				break;
+		}
+	}
+	while (true);
+	return ' ';
+}
+
+/*****************************************************************************************
+ ** Function: clone
+ ** Description: Makes a copy of this AI, for copies of the maze it's playing in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The caller owns the copy.
+ ****************************************************************************************/
+AIStrategy* RandomAI::clone() const { return new RandomAI(*this); }
@@ -0,0 +1,23 @@
+/*****************************************************************************************
+ ** Program Filename: randomai.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the RandomAI class, the AI strategy that just picks a 
+ **				 random move every turn (the original AI).
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#ifndef __randomai_h__
+#define __randomai_h__
+
+#include "aistrategy.h"
+#include "rng.h"
+
+class RandomAI : public AIStrategy {
+	protected:
+		virtual int getChar(const Maze& maze, Rng& rng) override;
+	public:
+		virtual AIStrategy* clone() const override;
+};
+
+#endif
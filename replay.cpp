@@ -0,0 +1,241 @@
+/*****************************************************************************************
+ ** Program Filename: replay.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the Replay class.
+ ** Input: Depends on the function, but usually the turns of a game or a replay file.
+ ** Output: Depends on the function, but it generally gives out the logged game, or a 
+ **			maze at some turn of it.
+ ****************************************************************************************/
+#include<ncurses.h>
+#include<fstream>
+#include<string>
+#include<vector>
+#include<cstdint>
+#include<climits>
+#include<algorithm>
+
+#include "consts.h"
+#include "replay.h"
+#include "maze.h"
+#include "mazeoptions.h"
+#include "aistrategy.h"
+
+/*****************************************************************************************
+ ** Function: Replay (constructor)
+ ** Description: Makes an empty Replay, to load one from a file into.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Replay::Replay() : Replay(START_MIN_MAZE_SIZE, START_MIN_MAZE_SIZE, 0, MazeOptions()) {}
+
+/*****************************************************************************************
+ ** Function: Replay (constructor)
+ ** Description: Makes a new Replay of a game on the given maze with no turns yet.
+ ** Parameters: width (int) - width of the maze
+ **				height (int) - height of the maze
+ **				seed (uint64_t) - the seed the maze was made with
+ **				options (const MazeOptions&) - the settings the maze was made with
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Replay::Replay(int width, int height, uint64_t seed, const MazeOptions& options) : 
+	width(width), height(height), seed(seed), options(options), 
+	snapshotTurns(REPLAY_SNAPSHOT_TURNS) {}
+
+/*****************************************************************************************
+ ** Function: toInput
+ ** Description: Turns an input for a turn into the char it's logged as. Everything that
+ **				 does the same thing in a turn is logged the same way (like 'w' and the 
+ **				 up arrow).
+ ** Parameters: chr (int) - the input given to the maze for the turn
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns 'w', 'a', 's', 'd', 'p', or a space.
+ ****************************************************************************************/
+char Replay::toInput(int chr) {
+	switch(chr) {
+		case 'w': case KEY_UP:
+			return 'w';
+		case 'a': case KEY_LEFT:
+			return 'a';
+		case 's': case KEY_DOWN:
+			return 's';
+		case 'd': case KEY_RIGHT:
+			return 'd';
+		case 'p':
+			return 'p';
+		default:
+			return ' ';
+	}
+}
+
+/*****************************************************************************************
+ ** Function: addTurn
+ ** Description: Logs the next turn of the game.
+ ** Parameters: input (int) - the input the maze was given for the turn
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void Replay::addTurn(int input) {
+	inputs.push_back(toInput(input));
+}
+
+/*****************************************************************************************
+ ** Function: save
+ ** Description: Saves the replay to a file. After the header, the maze, and which AI 
+ **				 strategy played (even if the AI didn't), the turns are written as runs,
+ **				 like "12d3.p" for 12 turns right, 3 turns waiting, and 1 turn using a 
+ **				 skill, since holding down a key makes a lot of them.
+ ** Parameters: fileName (const std::string&) - the file to save to
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns false if the file couldn't be written.
+ ****************************************************************************************/
+bool Replay::save(const std::string& fileName) const {
+	std::ofstream file(fileName);
+	if (!file.good()) return false;
+
+	file << REPLAY_FILE_HEADER << ' ' << REPLAY_FILE_VERSION << '\n';
+	file << width << ' ' << height << ' ' << seed << ' ' << options.difficulty << ' ' 
+		 << options.fogMode << ' ' << options.useAI << ' ' << options.genMode << ' ' 
+		 << AIStrategy::getName(options.aiStrategy) << '\n';
+	file << inputs.size() << '\n';
+
+	std::string line;
+	for (int i = 0; i < inputs.size(); ) {
+		int run = 1;
+		while (i + run < inputs.size() && inputs[i + run] == inputs[i]) run++;
+
+		std::string str = run > 1 ? std::to_string(run) : "";
+		str += inputs[i] == ' ' ? REPLAY_CHAR_WAIT : inputs[i];
+		if (line.length() + str.length() > REPLAY_LINE_LENGTH) {
+			file << line << '\n';
+			line.clear();
+		}
+		line += str;
+		i += run;
+	}
+	if (line.length() > 0) file << line << '\n';
+
+	return file.good();
+}
+
+/*****************************************************************************************
+ ** Function: load
+ ** Description: Loads a replay that was saved with save().
+ ** Parameters: fileName (const std::string&) - the file to load from
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns false if the file couldn't be read or isn't a replay this 
+ **					 version can play, in which case the replay is left empty.
+ ****************************************************************************************/
+bool Replay::load(const std::string& fileName) {
+	*this = Replay();
+
+	std::ifstream file(fileName);
+	std::string header;
+	int version = 0;
+	file >> header >> version;
+	if (!file.good() || header != REPLAY_FILE_HEADER || version != REPLAY_FILE_VERSION) 
+		return false;
+
+	Replay loaded;
+	std::string strategyName;
+	long long numTurns = -1;
+	file >> loaded.width >> loaded.height >> loaded.seed >> loaded.options.difficulty 
+		 >> loaded.options.fogMode >> loaded.options.useAI >> loaded.options.genMode 
+		 >> strategyName >> numTurns;
+	loaded.options.aiStrategy = AIStrategy::findStrategy(strategyName);
+	// turns are indexed with ints everywhere else
+	if (file.fail() || numTurns < 0 || numTurns > INT_MAX || 
+		loaded.options.aiStrategy == -1 ||
+		loaded.width < START_MIN_MAZE_SIZE || loaded.width > START_MAX_MAZE_SIZE || 
+		loaded.height < START_MIN_MAZE_SIZE || loaded.height > START_MAX_MAZE_SIZE || 
+		loaded.options.difficulty < OPTION_DIFF_EASY || 
+		loaded.options.difficulty > OPTION_DIFF_HARD || 
+		loaded.options.fogMode < OPTION_FOG_OFF || 
+		loaded.options.fogMode > OPTION_FOG_SIGHT || 
+		(loaded.options.genMode != MAZE_GEN_RETRY && 
+		 loaded.options.genMode != MAZE_GEN_CONSTRUCT)) 
+		return false;
+
+	// the runs of turns, with whitespace anywhere in between
+	long long run = 0;
+	char chr;
+	while (file >> chr) {
+		if (chr >= '0' && chr <= '9') {
+			run = run*10 + (chr - '0');
+			if (run > numTurns) return false;
+			continue;
+		}
+		if (chr == REPLAY_CHAR_WAIT) chr = ' ';
+		else if (toInput(chr) != chr) return false;
+
+		if (run == 0) run = 1;
+		if ((long long) loaded.inputs.size() + run > numTurns) return false;
+		loaded.inputs.append(run, chr);
+		run = 0;
+	}
+	if (run != 0 || (long long) loaded.inputs.size() != numTurns) return false;
+
+	*this = loaded;
+	return true;
+}
+
+/*****************************************************************************************
+ ** Function: makeSnapshots
+ ** Description: Plays the whole replay once, keeping a copy of the maze every 
+ **				 snapshotTurns turns, so seeking never has to play more than that many 
+ **				 turns to get anywhere. Should be called once before playing it back.
+ ** Parameters: maze (const Maze&) - the maze at turn 0
+ ** Pre-Conditions: maze was made with this replay's size, seed and options.
+ ** Post-Conditions: There's a snapshot for turn 0.
+ ****************************************************************************************/
+void Replay::makeSnapshots(const Maze& maze) {
+	// a long replay on a big maze spreads them out to keep them all in memory
+	long long cells = (long long) width*height;
+	long long maxSnapshots = REPLAY_SNAPSHOT_MEMORY/(cells*REPLAY_SNAPSHOT_CELL_BYTES);
+	snapshotTurns = std::max((long long) REPLAY_SNAPSHOT_TURNS, 
+							 getNumTurns()/std::max(maxSnapshots, 1LL) + 1);
+
+	// nothing draws this one, and the snapshots get drawn from scratch when they're used
+	Maze played = maze;
+	played.setTrackChanges(false);
+	snapshots.clear();
+	snapshots.push_back(maze);
+	for (int turn = 0; turn < getNumTurns(); turn++) {
+		played.takeTurn(inputs[turn]);
+		if ((turn + 1) % snapshotTurns == 0) {
+			snapshots.push_back(played);
+			snapshots.back().setTrackChanges(true);
+		}
+	}
+}
+
+/*****************************************************************************************
+ ** Function: seek
+ ** Description: Moves a maze being played back to another turn. It starts from the last
+ **				 snapshot before that turn (unless playing on from where the maze already
+ **				 is is closer), so it never plays more than REPLAY_SNAPSHOT_TURNS turns 
+ **				 (or more, for a long replay on a big maze).
+ ** Parameters: maze (Maze&) - the maze being played back
+ **				turn (int&) - the number of turns the maze has had, which is updated
+ **				target (int) - the turn to move to (kept inside the replay)
+ ** Pre-Conditions: makeSnapshots was called, and maze was played with this replay's 
+ **					turns.
+ ** Post-Conditions: maze is at turn target. Its changed squares are only the ones from 
+ **					 its last turn, so it needs to be drawn again from scratch.
+ ****************************************************************************************/
+void Replay::seek(Maze& maze, int& turn, int target) {
+	target = std::max(0, std::min(target, getNumTurns()));
+
+	int snap = std::min(target / snapshotTurns, (int) snapshots.size() - 1);
+	if (turn > target || snap*snapshotTurns > turn) {
+		maze = snapshots[snap];
+		turn = snap*snapshotTurns;
+	}
+
+	while (turn < target) {
+		maze.takeTurn(inputs[turn]);
+		turn++;
+	}
+}
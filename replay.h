@@ -0,0 +1,59 @@
+/*****************************************************************************************
+ ** Program Filename: replay.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the Replay class, the log of a game: what maze it was 
+ **				 (size, seed, and settings) and the input for every turn. The same maze 
+ **				 with the same inputs always plays out the same, so that's enough to play
+ **				 the whole game again. While playing one back, it also keeps snapshots of
+ **				 the maze so it can jump to any turn without starting over from turn 0.
+ ** Input: Depends on the function, but usually the turns of a game or a replay file.
+ ** Output: Depends on the function, but it generally gives out the logged game, or a 
+ **			maze at some turn of it.
+ ****************************************************************************************/
+#ifndef __replay_h__
+#define __replay_h__
+
+#include<vector>
+#include<string>
+#include<cstdint>
+
+#include "maze.h"
+#include "mazeoptions.h"
+
+class Replay {
+	private:
+		int width, height;
+		uint64_t seed;
+		MazeOptions options;
+
+		// one char per turn: w, a, s, d, p, or a space for anything else
+		std::string inputs;
+
+		// the maze every snapshotTurns turns, made all at once before playing it back
+		std::vector<Maze> snapshots;
+		int snapshotTurns;
+
+		static char toInput(int chr);
+	public:
+		Replay();
+		Replay(int width, int height, uint64_t seed, const MazeOptions& options);
+
+		int getWidth() const { return width; }
+		int getHeight() const { return height; }
+		uint64_t getSeed() const { return seed; }
+		const MazeOptions& getOptions() const { return options; }
+
+		int getNumTurns() const { return inputs.size(); }
+		int getInput(int turn) const { return inputs[turn]; }
+
+		void addTurn(int input);
+
+		bool save(const std::string& fileName) const;
+		bool load(const std::string& fileName);
+
+		void makeSnapshots(const Maze& maze);
+		void seek(Maze& maze, int& turn, int target);
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*****************************************************************************************
+ ** Program Filename: rng.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the Rng class.
+ ** Input: Depends on the function, but usually the seed or the range of the number.
+ ** Output: Depends on the function, but it generally gives out random numbers.
+ ****************************************************************************************/
+#include<cstdint>
+#include<random>
+#include<chrono>
+
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: Rng (constructor)
+ ** Description: Makes a new Rng with a seed of 0 on stream 0.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Rng::Rng() : Rng(0, 0) {}
+
+/*****************************************************************************************
+ ** Function: Rng (constructor)
+ ** Description: Makes a new Rng. Different streams with the same seed give unrelated
+ **				 numbers, so one seed can feed several generators.
+ ** Parameters: seed (uint64_t) - the seed to start from
+ **				stream (uint64_t) - which stream of that seed to use
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Rng::Rng(uint64_t seed, uint64_t stream) {
+	// splitmix never gives an all zero state (which xoshiro can't get out of)
+	uint64_t x = seed ^ (stream*0xD1B54A32D192ED03ULL);
+	for (int i = 0; i < 4; i++) state[i] = splitMix(x);
+}
+
+/*****************************************************************************************
+ ** Function: splitMix
+ ** Description: Steps a splitmix64 generator, which scrambles a counter into a well mixed
+ **				 number. Used for seeding.
+ ** Parameters: x (uint64_t&) - the generator's state
+ ** Pre-Conditions: none.
+ ** Post-Conditions: x has been stepped.
+ ****************************************************************************************/
+uint64_t Rng::splitMix(uint64_t& x) {
+	uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/*****************************************************************************************
+ ** Function: makeSeed
+ ** Description: Makes a new seed for when the user didn't give one. It's kept to 32 bits
+ **				 so it's short enough to show and type back in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+uint64_t Rng::makeSeed() {
+	uint64_t x = std::random_device()();
+	x ^= std::chrono::high_resolution_clock::now().time_since_epoch().count();
+	return splitMix(x) >> 32;
+}
+
+/*****************************************************************************************
+ ** Function: nextInt
+ ** Description: Gets a random number from 0 up to (not including) bound. Uses a multiply
+ **				 instead of a mod, and rejects the few values that would make it uneven.
+ ** Parameters: bound (int) - one past the biggest number to give
+ ** Pre-Conditions: bound is positive.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int Rng::nextInt(int bound) {
+	uint64_t m = (next() >> 32)*uint64_t(bound);
+	uint32_t low = uint32_t(m);
+
+	if (low < uint32_t(bound)) {
+		uint32_t threshold = uint32_t(-uint32_t(bound)) % uint32_t(bound);
+		while (low < threshold) {
+			m = (next() >> 32)*uint64_t(bound);
+			low = uint32_t(m);
+		}
+	}
+	return m >> 32;
+}
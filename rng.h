@@ -0,0 +1,45 @@
+/*****************************************************************************************
+ ** Program Filename: rng.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the Rng class, a small and fast random number generator
+ **				 (xoshiro256**) that can be seeded so the same seed always gives the same
+ **				 numbers. Each maze owns its own, so nothing is shared between mazes.
+ ** Input: Depends on the function, but usually the seed or the range of the number.
+ ** Output: Depends on the function, but it generally gives out random numbers.
+ ****************************************************************************************/
+#ifndef __rng_h__
+#define __rng_h__
+
+#include<cstdint>
+
+class Rng {
+	private:
+		uint64_t state[4];
+
+		static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+	public:
+		Rng();
+		Rng(uint64_t seed, uint64_t stream);
+
+		static uint64_t splitMix(uint64_t& x);
+		static uint64_t makeSeed();
+
+		// called a few times per person per turn, so it stays inline
+		uint64_t next() {
+			uint64_t result = rotl(state[1]*5, 7)*9;
+			uint64_t t = state[1] << 17;
+
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= t;
+			state[3] = rotl(state[3], 45);
+			return result;
+		}
+
+		int nextInt(int bound);
+};
+
+#endif
@@ -0,0 +1,349 @@
+/*****************************************************************************************
+ ** Program Filename: sim.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: The main function for the headless simulator (ass4-sim). It lets the AI 
+ **				 play a whole batch of mazes with no terminal and prints how it went, so 
+ **				 the difficulty constants can be tuned off of lots of games.
+ **				 It can also play a tournament (--tournament), where every AI strategy 
+ **				 plays the same batch of mazes, to compare how well and how fast they play.
+ **				 It can also play back a single recorded game (--replay) on the same 
+ **				 engine, to check that it still plays out the same and how fast.
+ ** Input: The settings for the batch (or the replay file), from the command line.
+ ** Output: The win rate, turns to finish, and speed of the batch (or replay, or every 
+ **			strategy in the tournament) to stdout.
+ ****************************************************************************************/
+#include<iostream>
+#include<iomanip>
+#include<string>
+#include<cstdint>
+#include<chrono>
+
+#include "consts.h"
+#include "batch.h"
+#include "cmdargs.h"
+#include "aistrategy.h"
+#include "rng.h"
+#include "replay.h"
+#include "simulation.h"
+
+namespace {
+	/*************************************************************************************
+	 ** Function: printUsage
+	 ** Description: Prints out how to use the simulator to stderr.
+	 ** Parameters: exeName (const char*) - the name the program was run with
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: none.
+	 ************************************************************************************/
+	void printUsage(const char* exeName) {
+		std::string strategies;
+		for (int i = 0; i < AI_NUM_STRATEGIES; i++) {
+			if (i > 0) strategies += i == AI_NUM_STRATEGIES - 1 ? ", or " : ", ";
+			strategies += AIStrategy::getName(i);
+		}
+
+		std::cerr << "usage: " << exeName << " [options]" << std::endl
+				  << "  -n, --games N       number of games to play (default " 
+				  << SIM_DEFAULT_GAMES << ")" << std::endl
+				  << "  --size N            make every maze N by N (default " 
+				  << SIM_DEFAULT_SIZE << ")" << std::endl
+				  << "  --width N           width of every maze" << std::endl
+				  << "  --height N          height of every maze" << std::endl
+				  << "  -d, --difficulty D  easy, medium, or hard (default medium)" 
+				  << std::endl
+				  << "  -s, --seed N        seed for the whole batch (default random)" 
+				  << std::endl
+				  << "  --max-turns N       give up on a game after N turns (default " 
+				  << SIM_DEFAULT_MAX_TURNS << ")" << std::endl
+				  << "  --gen MODE          construct or retry map generation" 
+				  << std::endl
+				  << "  --fog MODE          off, nearby, or sight (default off)" 
+				  << std::endl
+				  << "  -j, --threads N     threads to play games on (default one per core)" 
+				  << std::endl
+				  << "  --ai STRATEGY       " << strategies << " (default " 
+				  << AIStrategy::getName(OPTION_STRATEGY_DEFAULT) << ")" << std::endl
+				  << "  --tournament        play the batch once with every strategy and " 
+				  << "compare them" << std::endl
+				  << "  --replay FILE       play back a game saved with ass4 --record "
+				  << "instead" << std::endl;
+	}
+
+	/*************************************************************************************
+	 ** Function: parseArgs
+	 ** Description: Parses the command line arguments into the settings for the batch.
+	 ** Parameters: argc (int) - the number of arguments (including the program name)
+	 **				argv (char**) - the arguments themselves
+	 **				config (BatchConfig&) - output parameter for the settings
+	 **				replayFile (std::string&) - output parameter for the replay to play 
+	 **					back (left alone if there isn't one)
+	 **				tournament (bool&) - output parameter for whether to play every 
+	 **					strategy (left alone if not)
+	 ** Pre-Conditions: config already has the defaults in it.
+	 ** Post-Conditions: Returns false if something was wrong with the arguments, after
+	 **					 printing what to stderr.
+	 ************************************************************************************/
+	bool parseArgs(int argc, char** argv, BatchConfig& config, std::string& replayFile, 
+				   bool& tournament) {
+		for (int i = 1; i < argc; i++) {
+			std::string arg = argv[i];
+			const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+			uint64_t num = 0;
+
+			// the only argument without a value after it
+			if (arg == "--tournament") {
+				tournament = true;
+				continue;
+			}
+
+			if (arg == "-d" || arg == "--difficulty") {
+				std::string diff = value == nullptr ? "" : value;
+				if (diff == "easy") config.options.difficulty = OPTION_DIFF_EASY;
+				else if (diff == "medium") config.options.difficulty = OPTION_DIFF_MED;
+				else if (diff == "hard") config.options.difficulty = OPTION_DIFF_HARD;
+				else {
+					std::cerr << arg << " needs easy, medium, or hard after it" << std::endl;
+					return false;
+				}
+			}
+			else if (arg == "--fog") {
+				std::string mode = value == nullptr ? "" : value;
+				if (mode == "off") config.options.fogMode = OPTION_FOG_OFF;
+				else if (mode == "nearby") config.options.fogMode = OPTION_FOG_SQUARE;
+				else if (mode == "sight") config.options.fogMode = OPTION_FOG_SIGHT;
+				else {
+					std::cerr << arg << " needs off, nearby, or sight after it" << std::endl;
+					return false;
+				}
+			}
+			else if (arg == "--ai") {
+				int strategy = AIStrategy::findStrategy(value == nullptr ? "" : value);
+				if (strategy == -1) {
+					std::cerr << arg << " needs a strategy after it" << std::endl;
+					printUsage(argv[0]);
+					return false;
+				}
+				config.options.aiStrategy = strategy;
+			}
+			else if (arg == "--replay") {
+				if (value == nullptr) {
+					std::cerr << arg << " needs a file name after it" << std::endl;
+					return false;
+				}
+				replayFile = value;
+			}
+			else if (arg == "--gen") {
+				std::string mode = value == nullptr ? "" : value;
+				if (mode == "construct") config.options.genMode = MAZE_GEN_CONSTRUCT;
+				else if (mode == "retry") config.options.genMode = MAZE_GEN_RETRY;
+				else {
+					std::cerr << arg << " needs construct or retry after it" << std::endl;
+					return false;
+				}
+			}
+			else if (arg == "-n" || arg == "--games" || arg == "--size" || 
+					 arg == "--width" || arg == "--height" || arg == "-s" || 
+					 arg == "--seed" || arg == "--max-turns" || arg == "-j" || 
+					 arg == "--threads") {
+				if (!CmdArgs::parseNumber(value, num)) {
+					std::cerr << arg << " needs a whole number after it" << std::endl;
+					return false;
+				}
+
+				if (arg == "-s" || arg == "--seed") config.baseSeed = num;
+				else if (arg == "-n" || arg == "--games") {
+					if (num > SIM_MAX_GAMES) {
+						std::cerr << arg << " can be at most " << SIM_MAX_GAMES << std::endl;
+						return false;
+					}
+					config.games = num;
+				}
+				else if (arg == "-j" || arg == "--threads") {
+					if (num < 1 || num > SIM_MAX_THREADS) {
+						std::cerr << arg << " needs to be from 1 to " << SIM_MAX_THREADS 
+								  << " threads" << std::endl;
+						return false;
+					}
+					config.threads = num;
+				}
+				else if (arg == "--max-turns") {
+					if (num < 1 || num > SIM_MAX_TURNS) {
+						std::cerr << arg << " needs to be from 1 to " << SIM_MAX_TURNS 
+								  << std::endl;
+						return false;
+					}
+					config.maxTurns = num;
+				}
+				else if (num < START_MIN_MAZE_SIZE || num > START_MAX_MAZE_SIZE) {
+					std::cerr << arg << " needs to be from " << START_MIN_MAZE_SIZE 
+							  << " to " << START_MAX_MAZE_SIZE << std::endl;
+					return false;
+				}
+				else {
+					if (arg != "--height") config.width = num;
+					if (arg != "--width") config.height = num;
+				}
+			}
+			else {
+				std::cerr << "unknown argument: " << arg << std::endl;
+				printUsage(argv[0]);
+				return false;
+			}
+			i++;
+		}
+		return true;
+	}
+
+	/*************************************************************************************
+	 ** Function: printStats
+	 ** Description: Prints out the totals for a batch.
+	 ** Parameters: config (const BatchConfig&) - the settings the batch was run with
+	 **				stats (const BatchStats&) - the totals for the batch
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: none.
+	 ************************************************************************************/
+	void printStats(const BatchConfig& config, const BatchStats& stats) {
+		long long ended = stats.games - stats.timeouts;
+
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "maze:        " << config.width << "x" << config.height 
+				  << ", difficulty " << config.options.difficulty 
+				  << ", seed " << config.baseSeed << std::endl;
+		std::cout << "ai:          " << AIStrategy::getName(config.options.aiStrategy) 
+				  << std::endl;
+		std::cout << "threads:     " << config.threads << std::endl;
+		std::cout << "games:       " << stats.games << " (" << stats.timeouts 
+				  << " timed out after " << config.maxTurns << " turns)" << std::endl;
+
+		if (stats.games == 0) return;
+		std::cout << "win rate:    " << 100.0*stats.wins/stats.games << "%" << std::endl;
+		if (ended > 0) {
+			std::cout << "turns:       mean " << double(stats.totalTurns)/ended 
+					  << ", min " << stats.minTurns << ", max " << stats.maxTurns 
+					  << std::endl;
+		}
+
+		if (stats.seconds <= 0) return;
+		long long turns = stats.totalTurns + stats.timeouts*config.maxTurns;
+		std::cout << "time:        " << stats.seconds << " s" << std::endl;
+		std::cout << "games/s:     " << stats.games/stats.seconds << std::endl;
+		std::cout << "turns/s:     " << turns/stats.seconds << std::endl;
+
+		// just the turns on one thread, without making the mazes
+		if (stats.turnSeconds <= 0) return;
+		std::cout << "turn rate:   " << turns/stats.turnSeconds << " turns/s per thread" 
+				  << std::endl;
+
+		if (stats.decisions <= 0) return;
+		std::cout << "decisions:   " << 1e6*stats.decisionSeconds/stats.decisions 
+				  << " us per move" << std::endl;
+	}
+
+	/*************************************************************************************
+	 ** Function: runTournament
+	 ** Description: Plays the batch once with every AI strategy and prints a table 
+	 **				 comparing them. The batch seed is the same for all of them, so they 
+	 **				 all play the exact same mazes.
+	 ** Parameters: config (BatchConfig) - the settings for the batch (the strategy in it
+	 **					is ignored)
+	 ** Pre-Conditions: config.options.useAI is set.
+	 ** Post-Conditions: none.
+	 ************************************************************************************/
+	void runTournament(BatchConfig config) {
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "maze:        " << config.width << "x" << config.height 
+				  << ", difficulty " << config.options.difficulty 
+				  << ", seed " << config.baseSeed << std::endl;
+		std::cout << "threads:     " << config.threads << std::endl;
+		std::cout << "games:       " << config.games << " per strategy (given up on after "
+				  << config.maxTurns << " turns)" << std::endl << std::endl;
+
+		std::cout << std::left << std::setw(12) << "strategy" << std::right 
+				  << std::setw(10) << "win rate" << std::setw(12) << "mean turns" 
+				  << std::setw(10) << "timeouts" << std::setw(12) << "us/move" 
+				  << std::setw(12) << "games/s" << std::endl;
+
+		for (int i = 0; i < AI_NUM_STRATEGIES; i++) {
+			config.options.aiStrategy = i;
+			BatchStats stats = Batch::run(config);
+			long long ended = stats.games - stats.timeouts;
+
+			double winRate = stats.games > 0 ? 100.0*stats.wins/stats.games : 0;
+			double meanTurns = ended > 0 ? double(stats.totalTurns)/ended : 0;
+			double moveMicros = 0, gameRate = 0;
+			if (stats.decisions > 0) moveMicros = 1e6*stats.decisionSeconds/stats.decisions;
+			if (stats.seconds > 0) gameRate = stats.games/stats.seconds;
+
+			std::cout << std::left << std::setw(12) << AIStrategy::getName(i) << std::right
+					  << std::setw(9) << winRate << "%" << std::setw(12) << meanTurns 
+					  << std::setw(10) << stats.timeouts << std::setw(12) << moveMicros 
+					  << std::setw(12) << gameRate << std::endl;
+		}
+	}
+
+	/*************************************************************************************
+	 ** Function: playReplay
+	 ** Description: Plays back a recorded game with no terminal and prints how it went 
+	 **				 and how fast. The AI (if it played) makes its own moves again, so a 
+	 **				 change to it shows up as a different result.
+	 ** Parameters: fileName (const std::string&) - the replay file to play
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: Returns the exit code for the program (1 if the replay couldn't 
+	 **					 be read).
+	 ************************************************************************************/
+	int playReplay(const std::string& fileName) {
+		Replay replay;
+		if (!replay.load(fileName)) {
+			std::cerr << "couldn't read a replay from " << fileName << std::endl;
+			return 1;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		Simulation sim(replay.getWidth(), replay.getHeight(), replay.getSeed(), 
+					   replay.getOptions(), replay.getNumTurns());
+		auto turnStart = std::chrono::steady_clock::now();
+		for (int i = 0; i < replay.getNumTurns() && sim.step(replay.getInput(i)); i++);
+		auto end = std::chrono::steady_clock::now();
+
+		double seconds = std::chrono::duration<double>(end - start).count();
+		double turnSeconds = std::chrono::duration<double>(end - turnStart).count();
+
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "maze:        " << replay.getWidth() << "x" << replay.getHeight() 
+				  << ", difficulty " << replay.getOptions().difficulty 
+				  << ", seed " << replay.getSeed() << std::endl;
+		std::cout << "turns:       " << sim.getTurns() << " of " << replay.getNumTurns() 
+				  << std::endl;
+		std::cout << "result:      " << (!sim.getEnded() ? "didn't end" : 
+										 sim.getWon() ? "won" : "lost") << std::endl;
+		std::cout << "time:        " << seconds << " s" << std::endl;
+		if (turnSeconds > 0) {
+			std::cout << "turn rate:   " << sim.getTurns()/turnSeconds << " turns/s" 
+					  << std::endl;
+		}
+		return 0;
+	}
+}
+
+int main(int argc, char** argv) {
+	BatchConfig config;
+	config.games = SIM_DEFAULT_GAMES;
+	config.width = SIM_DEFAULT_SIZE;
+	config.height = SIM_DEFAULT_SIZE;
+	config.maxTurns = SIM_DEFAULT_MAX_TURNS;
+	config.baseSeed = Rng::makeSeed();
+	config.threads = Batch::getDefaultThreads();
+
+	std::string replayFile;
+	bool tournament = false;
+	if (!parseArgs(argc, argv, config, replayFile, tournament)) return 1;
+	if (replayFile != "") return playReplay(replayFile);
+
+	// nobody is at the keyboard, so it has to be the AI playing (fog only changes drawing)
+	config.options.useAI = true;
+	config.options.timeAI = true;
+
+	if (tournament) runTournament(config);
+	else printStats(config, Batch::run(config));
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*****************************************************************************************
+ ** Program Filename: simulation.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the Simulation class.
+ ** Input: The size, seed, and settings of the maze to play.
+ ** Output: Whether the game ended, whether it was won, and how many turns it took.
+ ****************************************************************************************/
+#include<cstdint>
+
+#include "simulation.h"
+#include "maze.h"
+#include "mazeoptions.h"
+
+/*****************************************************************************************
+ ** Function: Simulation (constructor)
+ ** Description: Makes a new game to simulate. The maze might already be over before any 
+ **				 turns if it was made with the student next to someone.
+ ** Parameters: width (int) - width of the maze
+ **				height (int) - height of the maze
+ **				seed (uint64_t) - the seed to make the maze with
+ **				options (const MazeOptions&) - the settings to make the maze with
+ **				maxTurns (int) - the number of turns before the game is given up on
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+Simulation::Simulation(int width, int height, uint64_t seed, const MazeOptions& options, 
+					   int maxTurns) : 
+	maze(width, height, seed, options), maxTurns(maxTurns), turns(0), ended(false), 
+	won(false) {
+	// nothing is drawn, so there's no point keeping track of what to redraw
+	maze.setTrackChanges(false);
+	ended = maze.checkGameEnd(won);
+}
+
+/*****************************************************************************************
+ ** Function: step
+ ** Description: Takes one turn in the maze, the same way Game does when it gets a key.
+ ** Parameters: input (int) - the key the student pressed (ignored when using the AI)
+ ** Pre-Conditions: none.
+ ** Post-Conditions: Returns whether the game is still going (not ended or timed out).
+ ****************************************************************************************/
+bool Simulation::step(int input) {
+	if (ended || turns >= maxTurns) return false;
+
+	maze.takeTurn(input);
+	turns++;
+	ended = maze.checkGameEnd(won);
+	return !ended && turns < maxTurns;
+}
+
+/*****************************************************************************************
+ ** Function: run
+ ** Description: Plays the game until it ends or times out. Only makes sense when the 
+ **				 maze is using the AI, since nobody is pressing keys.
+ ** Parameters: none.
+ ** Pre-Conditions: The maze was made with useAI set.
+ ** Post-Conditions: The game has ended or timed out.
+ ****************************************************************************************/
+void Simulation::run() {
+	while (step(' '));
+}
@@ -0,0 +1,41 @@
+/*****************************************************************************************
+ ** Program Filename: simulation.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the Simulation class, which plays one game on a Maze with
+ **				 no terminal at all. It's what Game does without the drawing, so lots of
+ **				 games can be played back to back by the batch runner.
+ ** Input: The size, seed, and settings of the maze to play.
+ ** Output: Whether the game ended, whether it was won, and how many turns it took.
+ ****************************************************************************************/
+#ifndef __simulation_h__
+#define __simulation_h__
+
+#include<cstdint>
+
+#include "maze.h"
+#include "mazeoptions.h"
+
+class Simulation {
+	private:
+		Maze maze;
+		int maxTurns;
+
+		int turns;
+		bool ended;
+		bool won;
+	public:
+		Simulation(int width, int height, uint64_t seed, const MazeOptions& options, 
+				   int maxTurns);
+
+		const Maze& getMaze() const { return maze; }
+		int getTurns() const { return turns; }
+		bool getEnded() const { return ended; }
+		bool getWon() const { return won; }
+		bool getTimedOut() const { return !ended && turns >= maxTurns; }
+
+		bool step(int input);
+		void run();
+};
+
+#endif
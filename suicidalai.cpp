@@ -0,0 +1,59 @@
+/*****************************************************************************************
+ ** Program Filename: suicidalai.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the SuicidalAI class. 
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#include "consts.h"
+#include "suicidalai.h"
+#include "maze.h"
+#include "tilegrid.h"
+#include "tagroup.h"
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: getChar
+ ** Description: Gets the first move on the way to the nearest TA. It never uses a skill,
+ **				 since that would only keep the TAs away. If it can't get to a TA, it 
+ **				 wanders randomly until one finds it.
+ ** Parameters: maze (const Maze&) - the maze the AI is playing in
+ **				rng (Rng&) - the maze's generator for the AI
+ ** Pre-Conditions: The AI is the student in maze.
+ ** Post-Conditions: The return value is a character that corresponds to a normal user 
+ **					 input for moving the character (WASD or space). It's only a space if 
+ **					 the AI is walled in.
+ ****************************************************************************************/
+int SuicidalAI::getChar(const Maze& maze, Rng& rng) {
+	TileView map = maze.getTiles();
+	const TAGroup& tas = maze.getTAs();
+	int row = maze.getStudent()->getRow(), col = maze.getStudent()->getCol();
+	int target = field.search(map, row, col, 
+							  [](int, int, int) { return false; }, 
+							  [&](int r, int c) { return tas.getCountAt(r, c) > 0; });
+	if (target != -1) return getMoveChar(field.getFirstMove(target));
+
+	const int moves[4] = {MAZE_MOVE_UP, MAZE_MOVE_DOWN, MAZE_MOVE_LEFT, MAZE_MOVE_RIGHT};
+	const int rowSteps[4] = {-1, 1, 0, 0};
+	const int colSteps[4] = {0, 0, -1, 1};
+	int open[4];
+	int numOpen = 0;
+	for (int i = 0; i < 4; i++) {
+		int r = row + rowSteps[i], c = col + colSteps[i];
+		if (map.inBounds(r, c) && field.getDistance(map.index(r, c)) == 1) 
+			open[numOpen++] = moves[i];
+	}
+
+	if (numOpen == 0) return ' ';
+	return getMoveChar(open[rng.nextInt(numOpen)]);
+}
+
+/*****************************************************************************************
+ ** Function: clone
+ ** Description: Makes a copy of this AI, for copies of the maze it's playing in.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The caller owns the copy.
+ ****************************************************************************************/
+AIStrategy* SuicidalAI::clone() const { return new SuicidalAI(*this); }
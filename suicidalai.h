@@ -0,0 +1,26 @@
+/*****************************************************************************************
+ ** Program Filename: suicidalai.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the SuicidalAI class, the AI strategy that goes looking 
+ **				 for the nearest TA and runs right into them.
+ ** Input: For the only public function here, it's the maze and everybody in it. 
+ ** Output: For the only public function here, it's the move the AI wants to take. 
+ ****************************************************************************************/
+#ifndef __suicidalai_h__
+#define __suicidalai_h__
+
+#include "aistrategy.h"
+#include "distancefield.h"
+#include "rng.h"
+
+class SuicidalAI : public AIStrategy {
+	private:
+		DistanceField field;
+	protected:
+		virtual int getChar(const Maze& maze, Rng& rng) override;
+	public:
+		virtual AIStrategy* clone() const override;
+};
+
+#endif
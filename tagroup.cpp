@@ -0,0 +1,133 @@
+/*****************************************************************************************
+ ** Program Filename: tagroup.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the TAGroup class.
+ ** Input: Depends on the function, but usually the maze the TAs are moving around in.
+ ** Output: Depends on the function, but generally gets where the TAs are.
+ ****************************************************************************************/
+#include<ncurses.h>
+#include<vector>
+#include<string>
+#include<cstdint>
+#include<algorithm>
+
+#include "consts.h"
+#include "tagroup.h"
+#include "tilegrid.h"
+#include "rng.h"
+
+/*****************************************************************************************
+ ** Function: getStatus
+ ** Description: Gets the status of the TAs (for the HUD).
+ ** Parameters: appeasedTurns (int) - the turns left that the maze's TAs are appeased for
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+const std::string TAGroup::getStatus(int appeasedTurns) {
+	if (appeasedTurns == 0) return TA_TEXT_NOT_APPEASED;
+
+	return TA_TEXT_APPEASED_1 + std::to_string(appeasedTurns) + TA_TEXT_APPEASED_2;
+}
+
+/*****************************************************************************************
+ ** Function: getDisplayChar
+ ** Description: Gets the character to display that represents a TA (the char itself and
+ **				 its color).
+ ** Parameters: appeased (bool) - whether the TAs are appeased right now
+ ** Pre-Conditions: Game colors have already been initialized. 
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TAGroup::getDisplayChar(bool appeased) {
+	if (appeased) return DISPLAY_CHAR_TA | COLOR_PAIR(GAME_CPAIR_TA_DISABLED);
+	return DISPLAY_CHAR_TA | COLOR_PAIR(GAME_CPAIR_TA_INSTRUCTOR);
+}
+
+/*****************************************************************************************
+ ** Function: clear
+ ** Description: Takes every TA out of the group and sets up the counts for a map of the
+ **				 given size.
+ ** Parameters: mapRows (int) - the number of rows in the maze
+ **				mapCols (int) - the number of columns in the maze
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TAGroup::clear(int mapRows, int mapCols) {
+	rows.clear();
+	cols.clear();
+	counts.assign(mapRows*mapCols, 0);
+	this->mapCols = mapCols;
+}
+
+/*****************************************************************************************
+ ** Function: add
+ ** Description: Adds a new TA to the group.
+ ** Parameters: row (int) - the row of the TA
+ **				col (int) - the column of the TA
+ ** Pre-Conditions: clear() was called with the size of the maze, and the square is in 
+ **					bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TAGroup::add(int row, int col) {
+	rows.push_back(row);
+	cols.push_back(col);
+	counts[row*mapCols + col]++;
+}
+
+/*****************************************************************************************
+ ** Function: move
+ ** Description: Has every TA try to move one square in a random direction. A TA stays 
+ **				 put if that would take it off the map, into a wall, or onto the 
+ **				 instructor. Picking directions and moving are done as two separate 
+ **				 tight loops over plain arrays, since big mazes have thousands of TAs.
+ **				 Only TAs that actually moved touch the counts.
+ ** Parameters: map (const TileView&) - the map of the maze
+ **				rng (Rng&) - the maze's generator for people moving
+ **				changed (vector<int>&) - the squares that changed this turn
+ ** Pre-Conditions: Every TA is in bounds.
+ ** Post-Conditions: The squares every TA moved from and to are added to changed.
+ ****************************************************************************************/
+void TAGroup::move(const TileView& map, Rng& rng, std::vector<int>& changed) {
+	// left, right, up, down
+	static const int dRow[4] = {0, 0, -1, 1};
+	static const int dCol[4] = {-1, 1, 0, 0};
+
+	int num = rows.size();
+	dirs.resize(num);
+
+	// 2 bits of a random number per TA, so one number covers 32 TAs
+	for (int i = 0; i < num; i += 32) {
+		uint64_t bits = rng.next();
+		int end = std::min(num, i + 32);
+		for (int j = i; j < end; j++) {
+			dirs[j] = bits & 3;
+			bits >>= 2;
+		}
+	}
+
+	// plain pointers, otherwise writing counts makes it reload every vector each time
+	int* rowPtr = rows.data();
+	int* colPtr = cols.data();
+	int* countPtr = counts.data();
+	const unsigned char* dirPtr = dirs.data();
+	const unsigned char* tiles = map.getRow(0);
+
+	unsigned int numRows = map.getRows(), numCols = map.getCols();
+	for (int i = 0; i < num; i++) {
+		int r = rowPtr[i] + dRow[dirPtr[i]], c = colPtr[i] + dCol[dirPtr[i]];
+
+		// negative numbers wrap around to huge ones, so this also checks for < 0
+		bool inBounds = (unsigned(r) < numRows) & (unsigned(c) < numCols);
+		int to = inBounds ? r*numCols + c : 0;
+		if (!inBounds || (tiles[to] & (TILE_KIND_MASK | TILE_INSTRUCTOR)) != TILE_OPEN) 
+			continue;
+
+		int from = rowPtr[i]*numCols + colPtr[i];
+		countPtr[from]--;
+		countPtr[to]++;
+		changed.push_back(from);
+		changed.push_back(to);
+		rowPtr[i] = r;
+		colPtr[i] = c;
+	}
+}
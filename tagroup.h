@@ -0,0 +1,49 @@
+/*****************************************************************************************
+ ** Program Filename: tagroup.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the TAGroup class, which holds every TA in a maze (the
+ **				 enemies that either need to be avoided or appeased). TAs are only a 
+ **				 position each, so they're kept as arrays of rows and columns and all moved
+ **				 together in one pass instead of one object at a time. It also keeps a
+ **				 count of the TAs on every square, so finding a TA near a square doesn't
+ **				 need to look through all of them.
+ ** Input: Depends on the function, but usually the maze the TAs are moving around in.
+ ** Output: Depends on the function, but generally gets where the TAs are.
+ ****************************************************************************************/
+#ifndef __tagroup_h__
+#define __tagroup_h__
+
+#include<vector>
+#include<string>
+
+#include "tilegrid.h"
+#include "rng.h"
+
+class TAGroup {
+	private:
+		std::vector<int> rows, cols;
+		// the number of TAs on each square, by tile index
+		std::vector<int> counts;
+		int mapCols;
+
+		// scratch space for the direction each TA picked this turn
+		std::vector<unsigned char> dirs;
+	public:
+		static const std::string getStatus(int appeasedTurns);
+		static int getDisplayChar(bool appeased);
+
+		void clear(int mapRows, int mapCols);
+		void add(int row, int col);
+
+		int size() const { return rows.size(); }
+		int getRow(int index) const { return rows[index]; }
+		int getCol(int index) const { return cols[index]; }
+
+		// checked around the student every turn, so it stays inline
+		int getCountAt(int row, int col) const { return counts[row*mapCols + col]; }
+
+		void move(const TileView& map, Rng& rng, std::vector<int>& changed);
+};
+
+#endif
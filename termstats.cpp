@@ -0,0 +1,133 @@
+/*****************************************************************************************
+ ** Program Filename: termstats.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for counting how much gets written to the terminal.
+ **				 ncurses writes straight to the terminal's file descriptor, so the bytes
+ **				 are counted from what Linux says the process wrote (/proc/self/io) before
+ **				 and after each frame. Nothing else writes while a frame is being sent.
+ ** Input: Frame and turn markers from the game.
+ ** Output: The totals, printed to whatever stream is given.
+ ****************************************************************************************/
+#include<cstdio>
+#include<cstring>
+#include<cstdint>
+#include<ostream>
+
+#include "termstats.h"
+
+namespace {
+	bool enabled = false;
+	bool available = true;
+
+	uint64_t bytes = 0, writes = 0, frames = 0, turns = 0;
+	// counters from the start of the current frame
+	uint64_t frameBytes = 0, frameWrites = 0;
+
+	/*************************************************************************************
+	 ** Function: readCounters
+	 ** Description: Reads how many bytes and write calls the process has made so far.
+	 ** Parameters: outBytes (uint64_t&) - output parameter for the bytes written
+	 **				outWrites (uint64_t&) - output parameter for the number of writes
+	 ** Pre-Conditions: none.
+	 ** Post-Conditions: Returns false if the counters couldn't be read (not Linux).
+	 ************************************************************************************/
+	bool readCounters(uint64_t& outBytes, uint64_t& outWrites) {
+#ifdef __linux__
+		FILE* file = std::fopen("/proc/self/io", "r");
+		if (file == nullptr) return false;
+
+		char name[32];
+		unsigned long long value;
+		int found = 0;
+		while (std::fscanf(file, "%31[^:]: %llu\n", name, &value) == 2) {
+			if (std::strcmp(name, "wchar") == 0) { outBytes = value; found++; }
+			else if (std::strcmp(name, "syscw") == 0) { outWrites = value; found++; }
+		}
+		std::fclose(file);
+		return found == 2;
+#else
+		return false;
+#endif
+	}
+}
+
+/*****************************************************************************************
+ ** Function: enable
+ ** Description: Turns on counting. Does nothing else until frames start being marked.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TermStats::enable() { enabled = true; }
+
+/*****************************************************************************************
+ ** Function: getEnabled
+ ** Description: Gets whether counting is turned on.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool TermStats::getEnabled() { return enabled; }
+
+/*****************************************************************************************
+ ** Function: startFrame
+ ** Description: Marks the start of a frame being sent to the terminal.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TermStats::startFrame() {
+	if (!enabled || !available) return;
+	available = readCounters(frameBytes, frameWrites);
+}
+
+/*****************************************************************************************
+ ** Function: endFrame
+ ** Description: Marks the end of a frame being sent to the terminal, and adds what was
+ **				 written since startFrame() to the totals.
+ ** Parameters: none.
+ ** Pre-Conditions: startFrame() was called right before sending the frame.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TermStats::endFrame() {
+	if (!enabled || !available) return;
+
+	uint64_t nowBytes, nowWrites;
+	available = readCounters(nowBytes, nowWrites);
+	if (!available) return;
+
+	bytes += nowBytes - frameBytes;
+	writes += nowWrites - frameWrites;
+	frames++;
+}
+
+/*****************************************************************************************
+ ** Function: addTurn
+ ** Description: Counts a turn taken in the game.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TermStats::addTurn() { turns++; }
+
+/*****************************************************************************************
+ ** Function: print
+ ** Description: Prints the totals (after the terminal has been given back).
+ ** Parameters: out (ostream&) - where to print to
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TermStats::print(std::ostream& out) {
+	if (!enabled) return;
+	if (!available) {
+		out << "terminal stats aren't available on this system" << std::endl;
+		return;
+	}
+
+	out << "frames sent: " << frames << std::endl;
+	out << "bytes written: " << bytes << " in " << writes << " writes" << std::endl;
+	if (frames > 0) out << "bytes per frame: " << double(bytes)/frames << std::endl;
+	out << "turns: " << turns << std::endl;
+	if (turns > 0) out << "bytes per turn: " << double(bytes)/turns << std::endl;
+}
@@ -0,0 +1,28 @@
+/*****************************************************************************************
+ ** Program Filename: termstats.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for counting how much gets written to the terminal (turned on
+ **				 with --stats). The game marks every frame it sends and every turn it 
+ **				 takes, and the totals get printed once the program is done.
+ ** Input: Frame and turn markers from the game.
+ ** Output: The totals, printed to whatever stream is given.
+ ****************************************************************************************/
+#ifndef __termstats_h__
+#define __termstats_h__
+
+#include<ostream>
+
+namespace TermStats {
+	void enable();
+	bool getEnabled();
+
+	// put around whatever writes a frame to the terminal (doupdate)
+	void startFrame();
+	void endFrame();
+	void addTurn();
+
+	void print(std::ostream& out);
+}
+
+#endif
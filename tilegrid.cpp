@@ -0,0 +1,166 @@
+/*****************************************************************************************
+ ** Program Filename: tilegrid.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the TileGrid and TileView classes.
+ ** Input: Depends on the function, but usually the row and column of a square.
+ ** Output: Depends on the function, but it generally gives out information about the
+ **			squares in the maze.
+ ****************************************************************************************/
+#include<ncurses.h>
+#include<vector>
+
+#include "consts.h"
+#include "tilegrid.h"
+
+/*****************************************************************************************
+ ** Function: TileView (constructor)
+ ** Description: Makes a new view over a block of tiles.
+ ** Parameters: tiles (const unsigned char*) - the row-major tiles to look at
+ **				rows (int) - the number of rows in the block
+ **				cols (int) - the number of columns in the block
+ ** Pre-Conditions: tiles holds at least rows*cols bytes and outlives the view.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+TileView::TileView(const unsigned char* tiles, int rows, int cols) : tiles(tiles),
+	rows(rows), cols(cols) {}
+
+/*****************************************************************************************
+ ** Function: getDisplayChar
+ ** Description: Gets the character to display that represents the given square (the
+ **				 char itself and its color).
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ **				inFog (bool) - whether the square is shrouded in fog or not
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileView::getDisplayChar(int row, int col, bool inFog) const {
+	unsigned char tile = get(row, col);
+
+	if ((tile & TILE_KIND_MASK) == TILE_WALL)
+		return DISPLAY_CHAR_WALL | (inFog ? COLOR_PAIR(GAME_CPAIR_WALL_FOG) : 0);
+	if ((tile & TILE_SKILL) && !inFog) return DISPLAY_CHAR_SKILL | COLOR_PAIR(GAME_CPAIR_SKILL);
+	return DISPLAY_CHAR_EMPTY;
+}
+
+/*****************************************************************************************
+ ** Function: TileGrid (constructor)
+ ** Description: Makes a new grid where every square is open and empty.
+ ** Parameters: rows (int) - the number of rows in the grid (its height)
+ **				cols (int) - the number of columns in the grid (its width)
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+TileGrid::TileGrid(int rows, int cols) : tiles(rows*cols, TILE_OPEN), rows(rows),
+	cols(cols) {}
+
+/*****************************************************************************************
+ ** Function: clear
+ ** Description: Resets every square to be open and empty (no walls or skills).
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileGrid::clear() { tiles.assign(tiles.size(), TILE_OPEN); }
+
+/*****************************************************************************************
+ ** Function: getRows
+ ** Description: Gets the number of rows in the grid.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileGrid::getRows() const { return rows; }
+
+/*****************************************************************************************
+ ** Function: getCols
+ ** Description: Gets the number of columns in the grid.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileGrid::getCols() const { return cols; }
+
+/*****************************************************************************************
+ ** Function: getView
+ ** Description: Gets a read-only view of the grid.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: The view is only good until the grid is destroyed.
+ ****************************************************************************************/
+TileView TileGrid::getView() const { return TileView(tiles.data(), rows, cols); }
+
+/*****************************************************************************************
+ ** Function: isOccupiable
+ ** Description: Checks whether a person can stand on the given square.
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool TileGrid::isOccupiable(int row, int col) const {
+	return (tiles[row*cols + col] & TILE_KIND_MASK) == TILE_OPEN;
+}
+
+/*****************************************************************************************
+ ** Function: hasSkill
+ ** Description: Checks whether the given square has a skill in it.
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool TileGrid::hasSkill(int row, int col) const {
+	return (tiles[row*cols + col] & TILE_SKILL) != 0;
+}
+
+/*****************************************************************************************
+ ** Function: hasInstructor
+ ** Description: Checks whether the instructor is on the given square.
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+bool TileGrid::hasInstructor(int row, int col) const {
+	return (tiles[row*cols + col] & TILE_INSTRUCTOR) != 0;
+}
+
+/*****************************************************************************************
+ ** Function: setWall
+ ** Description: Turns the given square into a wall (which can't hold a skill).
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: The square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileGrid::setWall(int row, int col) { tiles[row*cols + col] = TILE_WALL; }
+
+/*****************************************************************************************
+ ** Function: setSkill
+ ** Description: Sets whether the given square has a skill or not.
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ **				b (bool) - whether the square should have a skill
+ ** Pre-Conditions: The square is in bounds and open.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileGrid::setSkill(int row, int col, bool b) {
+	if (b) tiles[row*cols + col] |= TILE_SKILL;
+	else tiles[row*cols + col] &= ~TILE_SKILL;
+}
+
+/*****************************************************************************************
+ ** Function: setInstructor
+ ** Description: Sets whether the instructor is on the given square or not.
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ **				b (bool) - whether the instructor is on the square
+ ** Pre-Conditions: The square is in bounds and open.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileGrid::setInstructor(int row, int col, bool b) {
+	if (b) tiles[row*cols + col] |= TILE_INSTRUCTOR;
+	else tiles[row*cols + col] &= ~TILE_INSTRUCTOR;
+}
@@ -0,0 +1,71 @@
+/*****************************************************************************************
+ ** Program Filename: tilegrid.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the TileGrid and TileView classes. The grid stores every
+ **				 square in the maze as a single byte in one row-major block of memory, and
+ **				 the view is a cheap read-only handle to it that everyone else uses.
+ ** Input: Depends on the function, but usually the row and column of a square.
+ ** Output: Depends on the function, but it generally gives out information about the
+ **			squares in the maze.
+ ****************************************************************************************/
+#ifndef __tilegrid_h__
+#define __tilegrid_h__
+
+#include<vector>
+
+#include "consts.h"
+
+class TileView {
+	private:
+		const unsigned char* tiles;
+		int rows, cols;
+	public:
+		TileView(const unsigned char* tiles, int rows, int cols);
+
+		// these are called for every square every turn, so they stay inline
+		int getRows() const { return rows; }
+		int getCols() const { return cols; }
+		int index(int row, int col) const { return row*cols + col; }
+
+		bool inBounds(int row, int col) const {
+			return row >= 0 && row < rows && col >= 0 && col < cols;
+		}
+		bool isOccupiable(int row, int col) const {
+			return (tiles[index(row, col)] & TILE_KIND_MASK) == TILE_OPEN;
+		}
+		bool hasSkill(int row, int col) const {
+			return (tiles[index(row, col)] & TILE_SKILL) != 0;
+		}
+		bool hasInstructor(int row, int col) const {
+			return (tiles[index(row, col)] & TILE_INSTRUCTOR) != 0;
+		}
+		unsigned char get(int row, int col) const { return tiles[index(row, col)]; }
+		const unsigned char* getRow(int row) const { return tiles + row*cols; }
+
+		int getDisplayChar(int row, int col, bool inFog) const;
+};
+
+class TileGrid {
+	private:
+		std::vector<unsigned char> tiles;
+		int rows, cols;
+	public:
+		TileGrid(int rows, int cols);
+
+		void clear();
+
+		int getRows() const;
+		int getCols() const;
+		TileView getView() const;
+
+		bool isOccupiable(int row, int col) const;
+		bool hasSkill(int row, int col) const;
+		bool hasInstructor(int row, int col) const;
+
+		void setWall(int row, int col);
+		void setSkill(int row, int col, bool b);
+		void setInstructor(int row, int col, bool b);
+};
+
+#endif
@@ -0,0 +1,195 @@
+/*****************************************************************************************
+ ** Program Filename: tilemipmap.cpp
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Implementation file for the TileMipMap class.
+ ** Input: Depends on the function, but usually the square that changed or the space 
+ **		   there is to draw in.
+ ** Output: Depends on the function, but it generally gives out the counts for a block.
+ ****************************************************************************************/
+#include<vector>
+#include<algorithm>
+
+#include "tilemipmap.h"
+#include "tilegrid.h"
+
+/*****************************************************************************************
+ ** Function: TileMipMap (constructor)
+ ** Description: Makes a new TileMipMap for the given tiles. Nothing's counted until 
+ **				 build() is called.
+ ** Parameters: tiles (const TileView&) - the tiles to count, which need to stay around 
+ **					for as long as this does
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+TileMipMap::TileMipMap(const TileView& tiles) : tiles(tiles) {}
+
+/*****************************************************************************************
+ ** Function: build
+ ** Description: Counts everything from scratch, making levels until one block covers 
+ **				 the whole grid.
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileMipMap::build() {
+	levels.clear();
+
+	Level base;
+	base.rows = tiles.getRows();
+	base.cols = tiles.getCols();
+	base.walls.resize(base.rows*base.cols);
+	base.skills.resize(base.rows*base.cols);
+	for (int r = 0; r < base.rows; r++) {
+		for (int c = 0; c < base.cols; c++) {
+			base.walls[r*base.cols + c] = !tiles.isOccupiable(r, c);
+			base.skills[r*base.cols + c] = tiles.hasSkill(r, c);
+		}
+	}
+	levels.push_back(base);
+
+	while (levels.back().rows > 1 || levels.back().cols > 1) {
+		Level next;
+		next.rows = (levels.back().rows + 1)/2;
+		next.cols = (levels.back().cols + 1)/2;
+		next.walls.resize(next.rows*next.cols);
+		next.skills.resize(next.rows*next.cols);
+		levels.push_back(next);
+
+		for (int r = 0; r < next.rows; r++) {
+			for (int c = 0; c < next.cols; c++) updateBlock(levels.size() - 1, r, c);
+		}
+	}
+}
+
+/*****************************************************************************************
+ ** Function: update
+ ** Description: Recounts a single square and every block above it, after it changed 
+ **				 (like a skill getting picked up).
+ ** Parameters: row (int) - the row of the square
+ **				col (int) - the column of the square
+ ** Pre-Conditions: build() was already called and the square is in bounds.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileMipMap::update(int row, int col) {
+	Level& base = levels[0];
+	base.walls[row*base.cols + col] = !tiles.isOccupiable(row, col);
+	base.skills[row*base.cols + col] = tiles.hasSkill(row, col);
+
+	for (int level = 1; level < levels.size(); level++) {
+		row /= 2;
+		col /= 2;
+		updateBlock(level, row, col);
+	}
+}
+
+/*****************************************************************************************
+ ** Function: updateBlock
+ ** Description: Recounts a single block from the (up to) 4 blocks below it.
+ ** Parameters: level (int) - the level of the block
+ **				row (int) - the row of the block
+ **				col (int) - the column of the block
+ ** Pre-Conditions: level is at least 1 and the level below is already counted.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+void TileMipMap::updateBlock(int level, int row, int col) {
+	const Level& below = levels[level - 1];
+	int walls = 0, skills = 0;
+
+	for (int r = 2*row; r < std::min(2*row + 2, below.rows); r++) {
+		for (int c = 2*col; c < std::min(2*col + 2, below.cols); c++) {
+			walls += below.walls[r*below.cols + c];
+			skills += below.skills[r*below.cols + c];
+		}
+	}
+
+	Level& cur = levels[level];
+	cur.walls[row*cur.cols + col] = walls;
+	cur.skills[row*cur.cols + col] = skills;
+}
+
+/*****************************************************************************************
+ ** Function: getNumLevels
+ ** Description: Gets how many levels there are (the last one is a single block).
+ ** Parameters: none.
+ ** Pre-Conditions: none.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getNumLevels() const { return levels.size(); }
+
+/*****************************************************************************************
+ ** Function: getLevelFor
+ ** Description: Gets the most detailed level that fits in the given space (one block per
+ **				 char). 
+ ** Parameters: maxRows (int) - how many rows there are to draw in
+ **				maxCols (int) - how many columns there are to draw in
+ ** Pre-Conditions: build() was already called.
+ ** Post-Conditions: Returns the last level (a single block) if nothing else fits.
+ ****************************************************************************************/
+int TileMipMap::getLevelFor(int maxRows, int maxCols) const {
+	for (int level = 0; level < levels.size(); level++) {
+		if (levels[level].rows <= maxRows && levels[level].cols <= maxCols) return level;
+	}
+	return levels.size() - 1;
+}
+
+/*****************************************************************************************
+ ** Function: getRows
+ ** Description: Gets how many rows of blocks a level has.
+ ** Parameters: level (int) - the level to check
+ ** Pre-Conditions: The level exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getRows(int level) const { return levels[level].rows; }
+
+/*****************************************************************************************
+ ** Function: getCols
+ ** Description: Gets how many columns of blocks a level has.
+ ** Parameters: level (int) - the level to check
+ ** Pre-Conditions: The level exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getCols(int level) const { return levels[level].cols; }
+
+/*****************************************************************************************
+ ** Function: getWalls
+ ** Description: Gets how many walls are in a block.
+ ** Parameters: level (int) - the level of the block
+ **				row (int) - the row of the block
+ **				col (int) - the column of the block
+ ** Pre-Conditions: The block exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getWalls(int level, int row, int col) const {
+	return levels[level].walls[row*levels[level].cols + col];
+}
+
+/*****************************************************************************************
+ ** Function: getSkills
+ ** Description: Gets how many skills are in a block.
+ ** Parameters: level (int) - the level of the block
+ **				row (int) - the row of the block
+ **				col (int) - the column of the block
+ ** Pre-Conditions: The block exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getSkills(int level, int row, int col) const {
+	return levels[level].skills[row*levels[level].cols + col];
+}
+
+/*****************************************************************************************
+ ** Function: getSquares
+ ** Description: Gets how many squares of the maze are in a block (blocks on the bottom 
+ **				 and right edges can be cut off).
+ ** Parameters: level (int) - the level of the block
+ **				row (int) - the row of the block
+ **				col (int) - the column of the block
+ ** Pre-Conditions: The block exists.
+ ** Post-Conditions: none.
+ ****************************************************************************************/
+int TileMipMap::getSquares(int level, int row, int col) const {
+	int size = 1 << level;
+	int rows = std::min(size, tiles.getRows() - row*size);
+	int cols = std::min(size, tiles.getCols() - col*size);
+	return rows*cols;
+}
@@ -0,0 +1,49 @@
+/*****************************************************************************************
+ ** Program Filename: tilemipmap.h
+ ** Author: Crystal Lee
+ ** Date: 2023-03-06
+ ** Description: Header file for the TileMipMap class, a pyramid of zoomed out copies of
+ **				 the tile grid used for the minimap. Level 0 has one block per square, and
+ **				 each level after that has one block per 2x2 blocks of the level before, 
+ **				 holding how many walls and skills are in it. 
+ ** Input: Depends on the function, but usually the square that changed or the space 
+ **		   there is to draw in.
+ ** Output: Depends on the function, but it generally gives out the counts for a block.
+ ****************************************************************************************/
+#ifndef __tilemipmap_h__
+#define __tilemipmap_h__
+
+#include<vector>
+
+#include "tilegrid.h"
+
+class TileMipMap {
+	private:
+		struct Level {
+			int rows, cols;
+			// row-major, like the tile grid
+			std::vector<int> walls, skills;
+		};
+
+		TileView tiles;
+		std::vector<Level> levels;
+
+		void updateBlock(int level, int row, int col);
+	public:
+		TileMipMap(const TileView& tiles);
+
+		void build();
+		void update(int row, int col);
+
+		int getNumLevels() const;
+		int getLevelFor(int maxRows, int maxCols) const;
+		int getRows(int level) const;
+		int getCols(int level) const;
+
+		// block coords are for the given level 
+		int getWalls(int level, int row, int col) const;
+		int getSkills(int level, int row, int col) const;
+		int getSquares(int level, int row, int col) const;
+};
+
+#endif